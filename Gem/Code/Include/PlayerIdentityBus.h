@@ -20,6 +20,9 @@ namespace MultiplayerSample
         virtual void OnPlayerActivated([[maybe_unused]] Multiplayer::NetEntityId playerEntity) {}
         virtual void OnPlayerDeactivated([[maybe_unused]] Multiplayer::NetEntityId playerEntity) {}
         virtual void OnAutonomousPlayerNameChanged([[maybe_unused]] const char* playerName) {}
+
+        //! Sent on clients whenever any player's replicated name changes, and when a player that already has a name activates.
+        virtual void OnPlayerNameChanged([[maybe_unused]] Multiplayer::NetEntityId playerEntity, [[maybe_unused]] const char* playerName) {}
     };
 
     using PlayerIdentityNotificationBus = AZ::EBus<PlayerIdentityNotifications>;
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Components/DecalRing.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/chrono/chrono.h>
+
+namespace MultiplayerSample
+{
+    void DecalRing::Init(IDecalRingTarget* target, uint32_t slotCount)
+    {
+        m_target = target;
+        m_slots.clear();
+        m_slots.resize(AZStd::max(slotCount, 1u));
+        m_nextSlot = 0;
+        m_activeDecalCount = 0;
+        m_stats = Stats{};
+    }
+
+    void DecalRing::Clear()
+    {
+        m_target = nullptr;
+        m_slots.clear();
+        m_nextSlot = 0;
+        m_activeDecalCount = 0;
+    }
+
+    void DecalRing::Spawn(const AZ::Transform& worldTm, const SpawnDecalConfig& config, uint32_t currentTimeMs)
+    {
+        if (m_slots.empty())
+        {
+            return;
+        }
+
+        // The ring is filled in spawn order, so the next slot always holds the oldest decal; when the ring is full it gets replaced
+        const uint32_t slotIndex = m_nextSlot;
+        Slot& slot = m_slots[slotIndex];
+        m_nextSlot = (m_nextSlot + 1) % static_cast<uint32_t>(m_slots.size());
+        if (!slot.m_active)
+        {
+            ++m_activeDecalCount;
+        }
+        else
+        {
+            ++m_stats.m_stolen;
+        }
+        ++m_stats.m_spawns;
+
+        slot.m_spawnTimeMs = currentTimeMs;
+        slot.m_fadeInTimeMs = static_cast<uint32_t>(config.m_fadeInTimeSec * 1000.0f);
+        // Fade out animation starts after the fade in time and life time have passed.
+        slot.m_fadeOutStartTimeMs = slot.m_fadeInTimeMs + static_cast<uint32_t>(config.m_lifeTimeSec * 1000.0f);
+        // Clamp our minimum total fade time to 1 millisecond to avoid any potential divide-by-zero
+        slot.m_fadeOutTimeMs = AZStd::max(static_cast<uint32_t>(config.m_fadeOutTimeSec * 1000.0f), 1u);
+        slot.m_opacity = config.m_opacity;
+        slot.m_appliedOpacity = CalculateOpacity(slot, currentTimeMs);
+        slot.m_active = true;
+
+        m_target->ShowDecal(slotIndex, worldTm, config, slot.m_appliedOpacity);
+    }
+
+    void DecalRing::Update(uint32_t currentTimeMs)
+    {
+        if (m_activeDecalCount == 0)
+        {
+            return;
+        }
+
+        m_stats.m_peakActiveDecals = AZStd::max(m_stats.m_peakActiveDecals, m_activeDecalCount);
+
+        // Single pass over the ring. Decals that are fully visible keep the same opacity, so only fading decals reach the target.
+        for (uint32_t slotIndex = 0; slotIndex < static_cast<uint32_t>(m_slots.size()); ++slotIndex)
+        {
+            Slot& slot = m_slots[slotIndex];
+            if (!slot.m_active)
+            {
+                continue;
+            }
+
+            float opacity = CalculateOpacity(slot, currentTimeMs);
+            if (opacity < 0.0f)
+            {
+                // Done animating; hide the decal but keep its slot for the next spawn
+                opacity = 0.0f;
+                slot.m_active = false;
+                --m_activeDecalCount;
+            }
+
+            if (opacity != slot.m_appliedOpacity)
+            {
+                m_target->SetDecalOpacity(slotIndex, opacity);
+                slot.m_appliedOpacity = opacity;
+                ++m_stats.m_opacityUpdates;
+            }
+        }
+    }
+
+    uint32_t DecalRing::GetActiveDecalCount() const
+    {
+        return m_activeDecalCount;
+    }
+
+    uint32_t DecalRing::GetSlotCount() const
+    {
+        return static_cast<uint32_t>(m_slots.size());
+    }
+
+    const DecalRing::Stats& DecalRing::GetStats() const
+    {
+        return m_stats;
+    }
+
+    void DecalRing::ResetStats()
+    {
+        m_stats = Stats{};
+    }
+
+    float DecalRing::CalculateOpacity(const Slot& slot, uint32_t currentTimeMs)
+    {
+        const uint32_t ageMs = currentTimeMs - slot.m_spawnTimeMs;
+        if (ageMs < slot.m_fadeInTimeMs)
+        {
+            return slot.m_opacity * (static_cast<float>(ageMs) / static_cast<float>(slot.m_fadeInTimeMs));
+        }
+
+        if (ageMs < slot.m_fadeOutStartTimeMs)
+        {
+            return slot.m_opacity;
+        }
+
+        const uint32_t fadeOutAgeMs = ageMs - slot.m_fadeOutStartTimeMs;
+        if (fadeOutAgeMs < slot.m_fadeOutTimeMs)
+        {
+            return slot.m_opacity * (1.0f - (static_cast<float>(fadeOutAgeMs) / static_cast<float>(slot.m_fadeOutTimeMs)));
+        }
+
+        return -1.0f;
+    }
+
+    //! Counts calls instead of rendering, so the benchmark only measures the ring's own bookkeeping.
+    class StubDecalRingTarget
+        : public IDecalRingTarget
+    {
+    public:
+        void ShowDecal(uint32_t slot, [[maybe_unused]] const AZ::Transform& worldTm, [[maybe_unused]] const SpawnDecalConfig& config, float opacity) override
+        {
+            ++m_showCalls;
+            m_checksum += slot + static_cast<uint64_t>(opacity * 255.0f);
+        }
+
+        void SetDecalOpacity(uint32_t slot, float opacity) override
+        {
+            ++m_opacityCalls;
+            m_checksum += slot + static_cast<uint64_t>(opacity * 255.0f);
+        }
+
+        uint64_t m_showCalls = 0;
+        uint64_t m_opacityCalls = 0;
+        uint64_t m_checksum = 0;
+    };
+
+    void DecalRing::RunBenchmark(uint32_t slotCount, uint32_t spawnsPerTick, uint32_t tickCount)
+    {
+        // Simulates a 60 Hz client spawning short lived decals, like weapon impacts
+        constexpr uint32_t TickTimeMs = 16;
+        SpawnDecalConfig config;
+        config.m_lifeTimeSec = 2.0f;
+
+        StubDecalRingTarget target;
+        DecalRing ring;
+        ring.Init(&target, slotCount);
+
+        AZStd::chrono::steady_clock::duration spawnTime{};
+        AZStd::chrono::steady_clock::duration updateTime{};
+        for (uint32_t tick = 0; tick < tickCount; ++tick)
+        {
+            const uint32_t currentTimeMs = tick * TickTimeMs;
+
+            const auto spawnStart = AZStd::chrono::steady_clock::now();
+            for (uint32_t spawn = 0; spawn < spawnsPerTick; ++spawn)
+            {
+                ring.Spawn(AZ::Transform::CreateTranslation(AZ::Vector3(static_cast<float>(spawn), 0.0f, 0.0f)), config, currentTimeMs);
+            }
+            const auto updateStart = AZStd::chrono::steady_clock::now();
+            ring.Update(currentTimeMs);
+            const auto updateEnd = AZStd::chrono::steady_clock::now();
+
+            spawnTime += updateStart - spawnStart;
+            updateTime += updateEnd - updateStart;
+        }
+
+        const auto toMicroseconds = [](AZStd::chrono::steady_clock::duration duration)
+        {
+            return static_cast<double>(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(duration).count()) / 1000.0;
+        };
+        const double ticks = AZStd::max(static_cast<double>(tickCount), 1.0);
+        const double spawns = AZStd::max(static_cast<double>(ring.GetStats().m_spawns), 1.0);
+        AZLOG_INFO("Decal ring benchmark, %u slots, %u spawns per tick over %u ticks: %.3f us per update, %.3f us per spawn, "
+            "%u stolen, %llu opacity updates (checksum %llu)",
+            ring.GetSlotCount(), spawnsPerTick, tickCount, toMicroseconds(updateTime) / ticks, toMicroseconds(spawnTime) / spawns,
+            ring.GetStats().m_stolen, static_cast<unsigned long long>(target.m_opacityCalls), static_cast<unsigned long long>(target.m_checksum));
+    }
+
+    static void BenchmarkDecalRing(const AZ::ConsoleCommandContainer& arguments)
+    {
+        uint32_t slotCount = 64;
+        uint32_t spawnsPerTick = 4;
+        uint32_t tickCount = 10000;
+        if (arguments.size() > 0)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(slotCount, arguments[0]);
+        }
+        if (arguments.size() > 1)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(spawnsPerTick, arguments[1]);
+        }
+        if (arguments.size() > 2)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(tickCount, arguments[2]);
+        }
+        DecalRing::RunBenchmark(slotCount, spawnsPerTick, tickCount);
+    }
+    AZ_CONSOLEFREEFUNC(BenchmarkDecalRing, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Benchmarks the decal ring against a stub renderer, takes a slot count, spawns per tick and tick count (defaults to 64, 4 and 10000)");
+}
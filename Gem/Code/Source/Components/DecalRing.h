@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/vector.h>
+#include <DecalBus.h>
+
+namespace MultiplayerSample
+{
+    //! What a DecalRing drives. Decals are addressed by ring slot, so the ring never sees renderer handles.
+    class IDecalRingTarget
+    {
+    public:
+        virtual ~IDecalRingTarget() = default;
+
+        //! Places a new decal into the slot, replacing whatever the slot showed before.
+        virtual void ShowDecal(uint32_t slot, const AZ::Transform& worldTm, const SpawnDecalConfig& config, float opacity) = 0;
+
+        //! Changes the opacity of the decal in the slot, 0 hides it.
+        virtual void SetDecalOpacity(uint32_t slot, float opacity) = 0;
+    };
+
+    //! Fixed size ring of decals that fade in, live and fade out.
+    //! Spawning writes into the oldest slot, stealing it if it is still visible, and Update() only
+    //! forwards opacity changes of fading decals to the target.
+    class DecalRing
+    {
+    public:
+        struct Stats
+        {
+            uint32_t m_spawns = 0;
+            uint32_t m_stolen = 0;
+            uint32_t m_opacityUpdates = 0;
+            uint32_t m_peakActiveDecals = 0;
+        };
+
+        //! Starts with every slot hidden. The target must outlive the ring, or Clear() must be called first.
+        void Init(IDecalRingTarget* target, uint32_t slotCount);
+        void Clear();
+
+        void Spawn(const AZ::Transform& worldTm, const SpawnDecalConfig& config, uint32_t currentTimeMs);
+        void Update(uint32_t currentTimeMs);
+
+        uint32_t GetActiveDecalCount() const;
+        uint32_t GetSlotCount() const;
+
+        const Stats& GetStats() const;
+        void ResetStats();
+
+        //! Times spawning and updating against a stub target, so it runs headless without a renderer.
+        static void RunBenchmark(uint32_t slotCount, uint32_t spawnsPerTick, uint32_t tickCount);
+
+    private:
+        struct Slot
+        {
+            uint32_t m_spawnTimeMs = 0;
+            uint32_t m_fadeInTimeMs = 0;
+            uint32_t m_fadeOutStartTimeMs = 0;  //!< Relative to spawn time
+            uint32_t m_fadeOutTimeMs = 1;
+            float m_opacity = 1.0f;             //!< Opacity once fully faded in
+            float m_appliedOpacity = 0.0f;      //!< Last opacity sent to the target
+            bool m_active = false;
+        };
+
+        //! Returns the opacity of a decal at the given time, or a negative value once it has fully faded out.
+        static float CalculateOpacity(const Slot& slot, uint32_t currentTimeMs);
+
+        IDecalRingTarget* m_target = nullptr;
+        AZStd::vector<Slot> m_slots;
+        uint32_t m_nextSlot = 0;     //!< Slot that receives the next spawned decal, which is always the oldest one
+        uint32_t m_activeDecalCount = 0;
+        Stats m_stats;
+    };
+}
@@ -5,9 +5,19 @@
  *
  */
 
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <Components/ExampleFilteredEntityComponent.h>
 #include <Multiplayer/IMultiplayer.h>
+#include <MultiplayerSampleTypes.h>
+#include <Source/Components/Multiplayer/EnergyBallComponent.h>
+#include <Source/Components/PerfTest/PerfTestSpatialHash.h>
 
 AZ_CVAR(bool, mps_EnableFilteringEntities, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, enables the example of filtering entities");
 
@@ -43,12 +53,38 @@ namespace MultiplayerSample
 
     void ExampleFilteredEntityComponent::Activate()
     {
+        LoadRelevancyTierSettings();
+
+#if AZ_TRAIT_SERVER
+        // Owned by the system component, so it outlives any level this component is in
+        m_perfTestSpatialHash = AZ::Interface<PerfTestSpatialHash>::Get();
+#endif
+
+        // Pick up any entities that were activated before us, then track the rest as they come and go
+        AZ::ComponentApplicationBus::Broadcast(&AZ::ComponentApplicationRequests::EnumerateEntities, [this](AZ::Entity* entity)
+        {
+            if (entity->GetState() == AZ::Entity::State::Active)
+            {
+                ClassifyEntity(entity);
+            }
+        });
+        AZ::EntitySystemBus::Handler::BusConnect();
+
         AZ::Interface<IFilterEntityManager>::Register(this);
     }
 
     void ExampleFilteredEntityComponent::Deactivate()
     {
         AZ::Interface<IFilterEntityManager>::Unregister(this);
+
+        AZ::EntitySystemBus::Handler::BusDisconnect();
+        m_filterMasks.clear();
+        m_tieredEntities.clear();
+        m_connectionRelevancy.clear();
+
+#if AZ_TRAIT_SERVER
+        m_perfTestSpatialHash = nullptr;
+#endif
     }
 
     bool ExampleFilteredEntityComponent::IsEntityFiltered(
@@ -58,18 +94,278 @@ namespace MultiplayerSample
     {
         if (m_enabled && mps_EnableFilteringEntities)
         {
-            // Note: @IsEntityFiltered is a hot code path, so do your best to optimize this method.
-            // This example just uses entity names for filtering, for the sake of simplicity.
-            // In practice, one might implement this lookup using a specialized structure such as AZStd::map<AZ::EntityId, bool>, etc.
+            // Note: @IsEntityFiltered is a hot code path, called for every entity and connection pair.
+            // The name matching is done once when an entity activates, so this is just a lookup and a bit test.
+            if (!m_filterMasks.empty())
+            {
+                const auto maskIter = m_filterMasks.find(entity->GetId());
+                if (maskIter != m_filterMasks.end() && maskIter->second.GetBit(GetConnectionSlot(connectionId)))
+                {
+                    return true;
+                }
+            }
 
-            const bool evenConnectionId = static_cast<uint32_t>(connectionId) % 2 == 0;
+#if AZ_TRAIT_SERVER
+            // Perf test objects are bucketed into a grid as they move, only send the ones in cells around the connection's player
+            if (m_perfTestSpatialHash && m_perfTestSpatialHash->IsTracked(entity->GetId()))
+            {
+                const AZ::Entity* controlled = controllerEntity.GetEntity();
+                return controlled && !m_perfTestSpatialHash->IsObjectNear(entity->GetId(), controlled->GetTransform()->GetWorldTranslation());
+            }
+#endif
 
-            if (entity->GetName().starts_with( evenConnectionId ? m_filterNamesForEvenConnectionIds : m_filterNamesForOddConnectionIds ))
+            if (m_relevancySettings.m_enabled && m_tieredEntities.contains(entity->GetId()))
             {
-                return true;
+                return IsBeyondRelevancy(entity, controllerEntity.GetEntity(), connectionId);
             }
         }
 
         return false;
     }
+
+    void ExampleFilteredEntityComponent::OnEntityActivated(const AZ::EntityId& entityId)
+    {
+        AZ::Entity* entity = nullptr;
+        AZ::ComponentApplicationBus::BroadcastResult(entity, &AZ::ComponentApplicationRequests::FindEntity, entityId);
+        if (entity)
+        {
+            ClassifyEntity(entity);
+        }
+    }
+
+    void ExampleFilteredEntityComponent::OnEntityDeactivated(const AZ::EntityId& entityId)
+    {
+        m_filterMasks.erase(entityId);
+
+        if (m_tieredEntities.erase(entityId) > 0)
+        {
+            for (auto& [connectionId, connectionRelevancy] : m_connectionRelevancy)
+            {
+                connectionRelevancy.m_entities.erase(entityId);
+            }
+        }
+
+        // The controlled entity going away means the connection's player has left, drop everything tracked for it
+        AZStd::erase_if(m_connectionRelevancy, [&entityId](const auto& connectionEntry)
+        {
+            return connectionEntry.second.m_controllerEntityId == entityId;
+        });
+    }
+
+    void ExampleFilteredEntityComponent::OnEntityNameChanged(const AZ::EntityId& entityId, const AZStd::string& name)
+    {
+        UpdateFilterMask(entityId, name);
+    }
+
+    uint32_t ExampleFilteredEntityComponent::GetConnectionSlot(AzNetworking::ConnectionId connectionId)
+    {
+        return static_cast<uint32_t>(connectionId) % MaxFilterConnectionSlots;
+    }
+
+    void ExampleFilteredEntityComponent::UpdateFilterMask(const AZ::EntityId& entityId, const AZStd::string& name)
+    {
+        // This example just uses entity names for filtering, for the sake of simplicity.
+        const bool filterFromEven = name.starts_with(m_filterNamesForEvenConnectionIds);
+        const bool filterFromOdd = name.starts_with(m_filterNamesForOddConnectionIds);
+
+        ConnectionFilterMask mask;
+        for (uint32_t slot = 0; slot < MaxFilterConnectionSlots; ++slot)
+        {
+            mask.SetBit(slot, (slot % 2 == 0) ? filterFromEven : filterFromOdd);
+        }
+
+        if (mask.AnySet())
+        {
+            m_filterMasks[entityId] = mask;
+        }
+        else
+        {
+            m_filterMasks.erase(entityId);
+        }
+    }
+
+    void ExampleFilteredEntityComponent::ClassifyEntity(const AZ::Entity* entity)
+    {
+        UpdateFilterMask(entity->GetId(), entity->GetName());
+
+        if (entity->FindComponent<EnergyBallComponent>())
+        {
+            m_tieredEntities.insert(entity->GetId());
+        }
+    }
+
+    void ExampleFilteredEntityComponent::LoadRelevancyTierSettings()
+    {
+        m_relevancySettings = RelevancyTierSettings{};
+
+        if (const auto registry = AZ::SettingsRegistry::Get())
+        {
+            registry->Get(m_relevancySettings.m_enabled, RelevancyTiersEnabledSetting);
+
+            double distance = 0.0;
+            if (registry->Get(distance, RelevancyNearDistanceSetting))
+            {
+                m_relevancySettings.m_nearDistance = aznumeric_cast<float>(distance);
+            }
+            if (registry->Get(distance, RelevancyMidDistanceSetting))
+            {
+                m_relevancySettings.m_midDistance = aznumeric_cast<float>(distance);
+            }
+            if (registry->Get(distance, RelevancyHysteresisSetting))
+            {
+                m_relevancySettings.m_hysteresisDistance = aznumeric_cast<float>(distance);
+            }
+
+            AZ::s64 intervalMs = 0;
+            if (registry->Get(intervalMs, RelevancyMidUpdateIntervalSetting))
+            {
+                m_relevancySettings.m_midUpdateInterval = AZ::TimeMs{ intervalMs };
+            }
+            if (registry->Get(intervalMs, RelevancyFarUpdateIntervalSetting))
+            {
+                m_relevancySettings.m_farUpdateInterval = AZ::TimeMs{ intervalMs };
+            }
+        }
+
+        AZ_Warning("ExampleFilteredEntityComponent", m_relevancySettings.m_nearDistance <= m_relevancySettings.m_midDistance,
+            "Relevancy near distance (%.1f) is larger than the mid distance (%.1f), the mid tier will never be used",
+            m_relevancySettings.m_nearDistance, m_relevancySettings.m_midDistance);
+    }
+
+    bool ExampleFilteredEntityComponent::IsBeyondRelevancy(
+        const AZ::Entity* entity, const AZ::Entity* controllerEntity, AzNetworking::ConnectionId connectionId)
+    {
+        if (controllerEntity == nullptr)
+        {
+            // No controlled entity to measure from yet, keep everything relevant
+            return false;
+        }
+
+        ConnectionRelevancy& connectionRelevancy = m_connectionRelevancy[connectionId];
+        connectionRelevancy.m_controllerEntityId = controllerEntity->GetId();
+
+        const AZ::TimeMs currentTime = AZ::GetElapsedTimeMs();
+        auto [tieredIter, inserted] = connectionRelevancy.m_entities.try_emplace(entity->GetId());
+        TieredEntity& tieredEntity = tieredIter->second;
+        if (inserted || currentTime >= tieredEntity.m_nextUpdateTime)
+        {
+            const float distance = entity->GetTransform()->GetWorldTranslation().GetDistance(
+                controllerEntity->GetTransform()->GetWorldTranslation());
+
+            // A newly seen entity takes the tier at its distance, hysteresis only applies to entities already in a tier
+            tieredEntity.m_tier = CalculateRelevancyTier(
+                distance, inserted ? AZStd::nullopt : AZStd::optional<RelevancyTier>(tieredEntity.m_tier));
+            tieredEntity.m_nextUpdateTime = currentTime + GetRelevancyUpdateInterval(tieredEntity.m_tier);
+        }
+
+        return tieredEntity.m_tier == RelevancyTier::Far;
+    }
+
+    ExampleFilteredEntityComponent::RelevancyTier ExampleFilteredEntityComponent::CalculateRelevancyTier(
+        float distance, AZStd::optional<RelevancyTier> previousTier) const
+    {
+        const auto tierAtDistance = [this](float tierDistance)
+        {
+            if (tierDistance < m_relevancySettings.m_nearDistance)
+            {
+                return RelevancyTier::Near;
+            }
+            return (tierDistance < m_relevancySettings.m_midDistance) ? RelevancyTier::Mid : RelevancyTier::Far;
+        };
+
+        // Moving inwards is immediate, moving outwards has to clear the boundary by the hysteresis distance.
+        // This keeps entities sitting on a tier boundary from being created and destroyed on the client over and over.
+        const RelevancyTier tier = tierAtDistance(distance);
+        if (!previousTier.has_value() || tier <= *previousTier)
+        {
+            return tier;
+        }
+        return AZStd::max(*previousTier, tierAtDistance(distance - m_relevancySettings.m_hysteresisDistance));
+    }
+
+    AZ::TimeMs ExampleFilteredEntityComponent::GetRelevancyUpdateInterval(RelevancyTier tier) const
+    {
+        switch (tier)
+        {
+        case RelevancyTier::Mid:
+            return m_relevancySettings.m_midUpdateInterval;
+        case RelevancyTier::Far:
+            return m_relevancySettings.m_farUpdateInterval;
+        default:
+            return AZ::Time::ZeroTimeMs;
+        }
+    }
+
+    void ExampleFilteredEntityComponent::RunFilterBenchmark(uint32_t entityCount, uint32_t connectionCount)
+    {
+        // A standalone instance, so the benchmark doesn't depend on the level or on entities being active
+        ExampleFilteredEntityComponent filter;
+
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+        entities.reserve(entityCount);
+        for (uint32_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+        {
+            // A third of the entities are hidden from even connections and a third from odd ones
+            const char* prefix = (entityIndex % 3 == 0) ? filter.m_filterNamesForEvenConnectionIds.c_str()
+                : (entityIndex % 3 == 1) ? filter.m_filterNamesForOddConnectionIds.c_str() : "Benchmark Entity";
+            entities.push_back(AZStd::make_unique<AZ::Entity>(AZStd::string::format("%s %u", prefix, entityIndex).c_str()));
+            filter.UpdateFilterMask(entities.back()->GetId(), entities.back()->GetName());
+        }
+
+        uint32_t filteredByMask = 0;
+        const auto maskStart = AZStd::chrono::steady_clock::now();
+        for (uint32_t connectionIndex = 0; connectionIndex < connectionCount; ++connectionIndex)
+        {
+            const AzNetworking::ConnectionId connectionId{ connectionIndex };
+            for (const auto& entity : entities)
+            {
+                filteredByMask += filter.IsEntityFiltered(entity.get(), Multiplayer::ConstNetworkEntityHandle(), connectionId) ? 1 : 0;
+            }
+        }
+        const auto maskTime = AZStd::chrono::steady_clock::now() - maskStart;
+
+        // The per pair name comparison IsEntityFiltered() used to do
+        uint32_t filteredByName = 0;
+        const auto nameStart = AZStd::chrono::steady_clock::now();
+        for (uint32_t connectionIndex = 0; connectionIndex < connectionCount; ++connectionIndex)
+        {
+            const bool evenConnectionId = connectionIndex % 2 == 0;
+            const AZStd::string& filterName =
+                evenConnectionId ? filter.m_filterNamesForEvenConnectionIds : filter.m_filterNamesForOddConnectionIds;
+            for (const auto& entity : entities)
+            {
+                filteredByName += entity->GetName().starts_with(filterName) ? 1 : 0;
+            }
+        }
+        const auto nameTime = AZStd::chrono::steady_clock::now() - nameStart;
+
+        const double pairCount = AZStd::max(static_cast<double>(entityCount) * connectionCount, 1.0);
+        const auto toNanoseconds = [](AZStd::chrono::steady_clock::duration duration)
+        {
+            return static_cast<double>(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(duration).count());
+        };
+        AZLOG_INFO("Entity filter benchmark, %u entities x %u connections: mask %.2f ns per pair (%u filtered), "
+            "name compare %.2f ns per pair (%u filtered)",
+            entityCount, connectionCount, toNanoseconds(maskTime) / pairCount, filteredByMask,
+            toNanoseconds(nameTime) / pairCount, filteredByName);
+        AZ_Warning("ExampleFilteredEntityComponent", filteredByMask == filteredByName,
+            "Filter masks disagree with the name comparison they replaced");
+    }
+
+    static void BenchmarkEntityFilter(const AZ::ConsoleCommandContainer& arguments)
+    {
+        uint32_t entityCount = 10000;
+        uint32_t connectionCount = 10;
+        if (arguments.size() > 0)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(entityCount, arguments[0]);
+        }
+        if (arguments.size() > 1)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(connectionCount, arguments[1]);
+        }
+        ExampleFilteredEntityComponent::RunFilterBenchmark(entityCount, connectionCount);
+    }
+    AZ_CONSOLEFREEFUNC(BenchmarkEntityFilter, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Benchmarks entity filtering, takes an entity count and a connection count (defaults to 10000 and 10)");
 }
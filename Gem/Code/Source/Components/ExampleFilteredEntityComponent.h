@@ -8,15 +8,24 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/optional.h>
+#include <AzNetworking/DataStructures/FixedSizeBitset.h>
 #include <Multiplayer/NetworkEntity/IFilterEntityManager.h>
 
 namespace MultiplayerSample
 {
+    class PerfTestSpatialHash;
+
     //! @class ExampleFilteredEntityComponent
     //! @brief An example of using IFilterEntityManager to filter entities to clients.
     class ExampleFilteredEntityComponent final
         : public AZ::Component
         , public Multiplayer::IFilterEntityManager
+        , private AZ::EntitySystemBus::Handler
     {
     public:
         AZ_COMPONENT(MultiplayerSample::ExampleFilteredEntityComponent, "{7BF3BF1D-383A-40E7-BCF2-1ED5B2D2A43C}");
@@ -34,7 +43,85 @@ namespace MultiplayerSample
         bool IsEntityFiltered(AZ::Entity* entity, Multiplayer::ConstNetworkEntityHandle controllerEntity, AzNetworking::ConnectionId connectionId) override;
         //! }@
 
+        //! Times IsEntityFiltered() against the name comparison it replaced, over every pair of synthetic entities and connections.
+        static void RunFilterBenchmark(uint32_t entityCount, uint32_t connectionCount);
+
     private:
+        //! AZ::EntitySystemBus overrides.
+        //! @{
+        void OnEntityActivated(const AZ::EntityId& entityId) override;
+        void OnEntityDeactivated(const AZ::EntityId& entityId) override;
+        void OnEntityNameChanged(const AZ::EntityId& entityId, const AZStd::string& name) override;
+        //! }@
+
+        //! Connection ids are handed out sequentially, so a connection's slot in a filter mask is its id modulo the slot count.
+        //! Filter rules have to repeat every MaxFilterConnectionSlots connection ids, which even and odd rules do.
+        static constexpr uint32_t MaxFilterConnectionSlots = 64;
+
+        //! Bit set per connection slot (see GetConnectionSlot) that an entity is hidden from.
+        using ConnectionFilterMask = AzNetworking::FixedSizeBitset<MaxFilterConnectionSlots>;
+        static uint32_t GetConnectionSlot(AzNetworking::ConnectionId connectionId);
+
+        void ClassifyEntity(const AZ::Entity* entity);
+        void UpdateFilterMask(const AZ::EntityId& entityId, const AZStd::string& name);
+
+        // Only entities that are filtered from at least one connection are stored, so most lookups miss an almost empty map
+        AZStd::unordered_map<AZ::EntityId, ConnectionFilterMask> m_filterMasks;
+
+        //! Distance based relevancy tiers, relative to the entity controlled by each connection.
+        //! Near and mid tier entities stay relevant, far tier entities are filtered out until they come back into range.
+        //! Tiers further out are re-evaluated less often, so the per connection filtering cost drops with distance.
+        //! IFilterEntityManager can only make an entity relevant or not, so the mid tier replicates at the engine rate
+        //! rather than a reduced one, and only entities that have nothing but an unreliable state stream are tiered.
+        enum class RelevancyTier : uint8_t
+        {
+            Near,
+            Mid,
+            Far
+        };
+
+        //! Loaded from the settings registry, see the RelevancyTiers settings in MultiplayerSampleTypes.h.
+        struct RelevancyTierSettings
+        {
+            bool m_enabled = false;
+            float m_nearDistance = 30.0f;
+            float m_midDistance = 80.0f;
+            float m_hysteresisDistance = 5.0f;
+            AZ::TimeMs m_midUpdateInterval = AZ::TimeMs{ 250 };
+            AZ::TimeMs m_farUpdateInterval = AZ::TimeMs{ 1000 };
+        };
+
+        struct TieredEntity
+        {
+            RelevancyTier m_tier = RelevancyTier::Near;
+            AZ::TimeMs m_nextUpdateTime = AZ::Time::ZeroTimeMs;
+        };
+
+        struct ConnectionRelevancy
+        {
+            AZ::EntityId m_controllerEntityId;
+            AZStd::unordered_map<AZ::EntityId, TieredEntity> m_entities;
+        };
+
+        void LoadRelevancyTierSettings();
+        bool IsBeyondRelevancy(const AZ::Entity* entity, const AZ::Entity* controllerEntity, AzNetworking::ConnectionId connectionId);
+        //! Returns the tier at the given distance, entities already in a tier only move outwards past the hysteresis distance.
+        RelevancyTier CalculateRelevancyTier(float distance, AZStd::optional<RelevancyTier> previousTier) const;
+        AZ::TimeMs GetRelevancyUpdateInterval(RelevancyTier tier) const;
+
+        RelevancyTierSettings m_relevancySettings;
+
+        // Gameplay entities which are safe to drop at a distance. Energy balls replicate nothing but a short lived transform
+        // stream. Gems are not tiered, their state only changes when they spawn or are collected, so keeping them relevant
+        // at every distance costs no more than the reliable changes a far tier should still receive.
+        // Players and level entities are always relevant, the match UI reads them regardless of distance.
+        AZStd::unordered_set<AZ::EntityId> m_tieredEntities;
+        AZStd::unordered_map<AzNetworking::ConnectionId, ConnectionRelevancy> m_connectionRelevancy;
+
+#if AZ_TRAIT_SERVER
+        PerfTestSpatialHash* m_perfTestSpatialHash = nullptr;
+#endif
+
         bool m_enabled = true;
 
         AZStd::string m_filterNamesForEvenConnectionIds{ "Filter Even" };
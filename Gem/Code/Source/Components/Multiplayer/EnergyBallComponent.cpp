@@ -11,6 +11,7 @@
 #include <Multiplayer/Components/NetworkRigidBodyComponent.h>
 #include <MultiplayerSampleTypes.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/ILogger.h>
 #include <AzCore/EBus/IEventScheduler.h>
 #include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
@@ -72,7 +73,7 @@ namespace MultiplayerSample
         // Create an explosion effect wherever the ball was last at before deactivating.
         m_effect.TriggerEffect(GetEntity()->GetTransform()->GetWorldTM());
 
-        auto hitEvent = GetHitEvent();
+        const HitEvent& hitEvent = GetHitEvent();
 
         // Notify this entity about the weapon impact for every entity that was hit, this allows for blast decals.
         for (const HitEntity& hitEntity : hitEvent.m_hitEntities)
@@ -134,6 +135,10 @@ namespace MultiplayerSample
 
     void EnergyBallComponentController::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+#if AZ_TRAIT_SERVER
+        // Hit effect and gather params are archetype properties, so the table only needs building once
+        m_damageFalloff = HitEffectFalloffTable(GetHitEffect(), GetGatherParams().m_castDistance);
+#endif
     }
 
     void EnergyBallComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
@@ -172,7 +177,6 @@ namespace MultiplayerSample
     void EnergyBallComponentController::CheckForCollisions()
     {
         const AZ::Vector3& position = GetEntity()->GetTransform()->GetWorldTM().GetTranslation();
-        const HitEffect& effect = GetHitEffect();
 
         // Sweep from our last checked transform to our current position to avoid tunneling
         const ActivateEvent activateEvent{ m_lastSweepTransform, position, m_shooterNetEntityId, GetNetEntityId() };
@@ -182,18 +186,27 @@ namespace MultiplayerSample
 
         if (!results.empty())
         {
+            bool hitEventFull = false;
             for (const IntersectResult& result : results)
             {
-                const HitEntity hitEntity{ result.m_position, result.m_normal, result.m_netEntityId };
-                ModifyHitEvent().m_hitEntities.emplace_back(hitEntity);
+                HitEntities& hitEntities = ModifyHitEvent().m_hitEntities;
+                if (hitEntities.size() < hitEntities.capacity())
+                {
+                    hitEntities.emplace_back(HitEntity{ result.m_position, result.m_normal, result.m_netEntityId });
+                }
+                else if (!hitEventFull)
+                {
+                    // Still apply damage to the remaining hits, they are only left out of the replicated hit event
+                    AZLOG_WARN("Energy ball hit more than %u entities, dropping the remaining hits from its hit event", MaxHitEntities);
+                    hitEventFull = true;
+                }
 
                 const Multiplayer::ConstNetworkEntityHandle handle = Multiplayer::GetNetworkEntityManager()->GetEntity(result.m_netEntityId);
                 if (handle.Exists())
                 {
-                    // Presently set to 1 until we capture falloff range
-                    float hitDistance = 1.f;
-                    float maxDistance = 1.f;
-                    float damage = effect.m_hitMagnitude * powf((effect.m_hitFalloff * (1.0f - hitDistance / maxDistance)), effect.m_hitExponent);
+                    // Falloff runs from the ball's center out to the cast distance, the same lookup weapons use
+                    const float hitDistance = position.GetDistance(result.m_position);
+                    const float damage = m_damageFalloff.GetMagnitude(hitDistance);
 
                     // Look for physics rigid body component and make impact updates
                     if (Multiplayer::NetworkRigidBodyComponent* rigidBodyComponent = handle.GetEntity()->FindComponent<Multiplayer::NetworkRigidBodyComponent>())
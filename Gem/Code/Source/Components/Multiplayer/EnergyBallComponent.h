@@ -68,6 +68,7 @@ namespace MultiplayerSample
         AZ::Transform m_lastSweepTransform = AZ::Transform::CreateIdentity();
         Multiplayer::NetEntityId m_shooterNetEntityId = Multiplayer::InvalidNetEntityId;
         NetEntityIdSet m_filteredNetEntityIds;
+        HitEffectFalloffTable m_damageFalloff; // HitEffect sampled out to the gather params' cast distance
 #endif
     };
 }
@@ -5,7 +5,11 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/Random.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <Source/Components/Multiplayer/MatchPlayerCoinsComponent.h>
 
 namespace MultiplayerSample
@@ -23,6 +27,8 @@ namespace MultiplayerSample
 
     void MatchPlayerCoinsComponent::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+        CoinsPerPlayerAddEvent(m_coinsChangedHandler);
+
 #if AZ_TRAIT_CLIENT
         AZ::Interface<MatchPlayerCoinsComponent>::Register(this);
 #endif
@@ -33,19 +39,15 @@ namespace MultiplayerSample
 #if AZ_TRAIT_CLIENT
         AZ::Interface<MatchPlayerCoinsComponent>::Unregister(this);
 #endif
+
+        m_coinsChangedHandler.Disconnect();
     }
 
-    AZStd::vector<PlayerCoinState> MatchPlayerCoinsComponent::GetPlayerCoinCounts() const
+    MatchPlayerCoinsComponent::PlayerCoinCountsView MatchPlayerCoinsComponent::GetPlayerCoinCounts() const
     {
-        AZStd::vector<PlayerCoinState> out;
-        // We can return AZStd::array<PlayerCoinState, N> but only if the property is not rewindable, this will support either option.
+        // The property isn't rewindable, so this is the replicated array itself rather than a rewound copy
         const auto& coins = GetCoinsPerPlayerArray();
-        for (const auto& state : coins)
-        {
-            out.push_back(PlayerCoinState(state));
-        }
-
-        return out;
+        return PlayerCoinCountsView{ AZStd::span<const PlayerCoinState>(coins.data(), coins.size()), m_coinsVersion };
     }
 
     MatchPlayerCoinsComponentController::MatchPlayerCoinsComponentController(MatchPlayerCoinsComponent& parent)
@@ -68,7 +70,7 @@ namespace MultiplayerSample
     {
         for (int i = 0; i < MultiplayerSample::MaxSupportedPlayers; ++i)
         {
-            ModifyCoinsPerPlayer(i).m_coins = 0;
+            UpdateCoinState(i, PlayerCoinState{ GetCoinsPerPlayer(i).m_playerId, 0 });
         }
     }
 
@@ -78,8 +80,7 @@ namespace MultiplayerSample
         const int stateIndex = GetCoinStateIndex(playerEntity);
         if (stateIndex >= 0)
         {
-            ModifyCoinsPerPlayer(stateIndex).m_playerId = playerEntity;
-            ModifyCoinsPerPlayer(stateIndex).m_coins = coinsCollected;
+            UpdateCoinState(stateIndex, PlayerCoinState{ playerEntity, coinsCollected });
         }
     }
 
@@ -98,8 +99,7 @@ namespace MultiplayerSample
 
         if (stateIndex >= 0 && stateIndex < stateCount)
         {
-            ModifyCoinsPerPlayer(stateIndex).m_playerId = playerEntity;
-            ModifyCoinsPerPlayer(stateIndex).m_coins = 0;
+            UpdateCoinState(stateIndex, PlayerCoinState{ playerEntity, 0 });
         }
     }
 
@@ -108,8 +108,16 @@ namespace MultiplayerSample
         const int stateIndex = GetCoinStateIndex(playerEntity);
         if (stateIndex >= 0)
         {
-            ModifyCoinsPerPlayer(stateIndex).m_playerId = Multiplayer::InvalidNetEntityId;
-            ModifyCoinsPerPlayer(stateIndex).m_coins = 0;
+            UpdateCoinState(stateIndex, PlayerCoinState{});
+        }
+    }
+
+    void MatchPlayerCoinsComponentController::UpdateCoinState(int32_t stateIndex, const PlayerCoinState& state)
+    {
+        if (GetCoinsPerPlayer(stateIndex) != state)
+        {
+            ModifyCoinsPerPlayer(stateIndex) = state;
+            ++GetParent().m_coinsVersion;
         }
     }
 #endif
@@ -133,4 +141,103 @@ namespace MultiplayerSample
 
         return -1;
     }
+
+    void MatchPlayerCoinsComponent::RunLobbyBandwidthBenchmark(uint32_t maxPlayers, uint32_t seconds, float coinsPerPlayerPerMinute, uint32_t tickRateHz)
+    {
+        AZStd::vector<uint8_t> buffer(64 * 1024);
+        const auto serializedSize = [&buffer](auto& value)
+        {
+            AzNetworking::NetworkInputSerializer serializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+            serializer.Serialize(value, "Value");
+            return serializer.GetSize();
+        };
+
+        const uint32_t tickCount = AZStd::max(seconds * tickRateHz, 1u);
+        const float coinChancePerTick = coinsPerPlayerPerMinute / (60.0f * AZStd::max(tickRateHz, 1u));
+        AZ::SimpleLcgRandom random(1234);
+
+        for (uint32_t playerCount = AZStd::min(10u, maxPlayers); playerCount <= maxPlayers;
+            playerCount = (playerCount < maxPlayers) ? AZStd::min(playerCount * 2, maxPlayers) : maxPlayers + 1)
+        {
+            AZStd::vector<PlayerCoinState> coins(playerCount);
+            for (uint32_t player = 0; player < playerCount; ++player)
+            {
+                coins[player].m_playerId = Multiplayer::NetEntityId{ player + 1 };
+            }
+
+            // Every slot is always sent for the full array, so its size doesn't depend on the coin counts
+            uint64_t fullArrayBytes = 0;
+            for (PlayerCoinState& state : coins)
+            {
+                fullArrayBytes += serializedSize(state);
+            }
+
+            const uint32_t dirtyBitBytes = (playerCount + 7) / 8;
+            uint64_t sparseBytes = 0;
+            uint64_t fullBytes = 0;
+            for (uint32_t tick = 0; tick < tickCount; ++tick)
+            {
+                uint64_t changedBytes = 0;
+                bool changed = false;
+                for (PlayerCoinState& state : coins)
+                {
+                    if (random.GetRandomFloat() < coinChancePerTick)
+                    {
+                        ++state.m_coins;
+                        changedBytes += serializedSize(state);
+                        changed = true;
+                    }
+                }
+
+                if (changed)
+                {
+                    sparseBytes += dirtyBitBytes + changedBytes;
+                    fullBytes += fullArrayBytes;
+                }
+            }
+
+            MatchResultsSummary summary;
+            summary.m_winningPlayerName = "Player 1";
+            summary.m_playerStates.resize(playerCount);
+            for (uint32_t player = 0; player < playerCount; ++player)
+            {
+                summary.m_playerStates[player].m_playerName = PlayerNameString::format("Player %u", player + 1);
+                summary.m_playerStates[player].m_score = coins[player].m_coins;
+            }
+
+            const double simulatedSeconds = static_cast<double>(tickCount) / AZStd::max(tickRateHz, 1u);
+            AZLOG_INFO("Lobby bandwidth benchmark, %u players over %.0f s at %u Hz: coin state %.1f bytes per client per second sparse, "
+                "%.1f sending every slot, results summary %u bytes once per round",
+                playerCount, simulatedSeconds, tickRateHz, sparseBytes / simulatedSeconds, fullBytes / simulatedSeconds,
+                static_cast<uint32_t>(serializedSize(summary)));
+        }
+    }
+
+    static void BenchmarkLobbyBandwidth(const AZ::ConsoleCommandContainer& arguments)
+    {
+        uint32_t maxPlayers = 100;
+        uint32_t seconds = 60;
+        float coinsPerPlayerPerMinute = 6.0f;
+        uint32_t tickRateHz = 30;
+        if (arguments.size() > 0)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(maxPlayers, arguments[0]);
+        }
+        if (arguments.size() > 1)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(seconds, arguments[1]);
+        }
+        if (arguments.size() > 2)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(coinsPerPlayerPerMinute, arguments[2]);
+        }
+        if (arguments.size() > 3)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(tickRateHz, arguments[3]);
+        }
+        MatchPlayerCoinsComponent::RunLobbyBandwidthBenchmark(maxPlayers, seconds, coinsPerPlayerPerMinute, tickRateHz);
+    }
+    AZ_CONSOLEFREEFUNC(BenchmarkLobbyBandwidth, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Reports per client bandwidth of the per player match state against lobby size, takes a max player count, seconds, "
+        "coins per player per minute and tick rate (defaults to 100, 60, 6 and 30)");
 }
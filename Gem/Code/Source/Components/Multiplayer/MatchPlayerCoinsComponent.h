@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AzCore/std/containers/span.h>
 #include <PlayerCoinCollectorBus.h>
 #include <Source/AutoGen/MatchPlayerCoinsComponent.AutoComponent.h>
 
@@ -23,8 +24,31 @@ namespace MultiplayerSample
         void OnActivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
         void OnDeactivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
 
-        //! Returns the coin count (aka score) of all the players currently in game
-        AZStd::vector<PlayerCoinState> GetPlayerCoinCounts() const;
+        //! A view of the replicated coin counts, valid until the next network update.
+        //! m_version changes whenever any slot changes, so callers can skip their work if it matches the last version they saw.
+        struct PlayerCoinCountsView
+        {
+            AZStd::span<const PlayerCoinState> m_coins;
+            uint32_t m_version = 0;
+        };
+
+        //! Returns the coin count (aka score) of all the players currently in game, without copying or allocating
+        PlayerCoinCountsView GetPlayerCoinCounts() const;
+
+        //! Models the bytes each client receives per second for the per player match state, at doubling lobby sizes up to maxPlayers.
+        //! Coin changes are sent as a dirty bit per slot plus the changed slots, this is compared against sending every slot,
+        //! and the end of round results summary is reported separately since it is only sent once.
+        static void RunLobbyBandwidthBenchmark(uint32_t maxPlayers, uint32_t seconds, float coinsPerPlayerPerMinute, uint32_t tickRateHz);
+
+    private:
+        friend class MatchPlayerCoinsComponentController;
+
+        AZ::Event<int32_t, PlayerCoinState>::Handler m_coinsChangedHandler{ [this](int32_t, PlayerCoinState)
+        {
+            ++m_coinsVersion;
+        } };
+
+        uint32_t m_coinsVersion = 0;
     };
 
     class MatchPlayerCoinsComponentController
@@ -49,6 +73,11 @@ namespace MultiplayerSample
 #endif
 
     private:
+#if AZ_TRAIT_SERVER
+        //! Only touches the slot if it actually changed, so unchanged slots aren't marked dirty and re-sent
+        void UpdateCoinState(int32_t stateIndex, const PlayerCoinState& state);
+#endif
+
         // Return -1 if a state is not available for this player id
         int GetCoinStateIndex(Multiplayer::NetEntityId playerEntity) const;
     };
@@ -32,6 +32,15 @@ namespace MultiplayerSample
     void PlayerIdentityComponent::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
         #if AZ_TRAIT_CLIENT
+            PlayerNameAddEvent(m_onPlayerNameChanged);
+
+            // The change event doesn't fire for the name the player arrived with, so listeners that looked it up
+            // before the player replicated still get it
+            if (!GetPlayerName().empty())
+            {
+                PlayerIdentityNotificationBus::Broadcast(&PlayerIdentityNotifications::OnPlayerNameChanged, GetNetEntityId(), GetPlayerName().c_str());
+            }
+
             m_viewport = AZ::RPI::ViewportContextRequests::Get()->GetDefaultViewportContext();
             if (!m_viewport)
             {
@@ -65,6 +74,7 @@ namespace MultiplayerSample
     {
         #if AZ_TRAIT_CLIENT
             AZ::TickBus::Handler::BusDisconnect();
+            m_onPlayerNameChanged.Disconnect();
         #endif
     }
 
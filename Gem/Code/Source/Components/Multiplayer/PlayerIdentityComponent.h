@@ -49,6 +49,11 @@ namespace MultiplayerSample
             AZ::RPI::ViewportContextPtr m_viewport;
             AzFramework::FontDrawInterface* m_fontDrawInterface = nullptr;
             AzFramework::TextDrawParameters m_drawParams;
+
+            AZ::Event<PlayerNameString>::Handler m_onPlayerNameChanged{ [this](const PlayerNameString& playerName)
+            {
+                PlayerIdentityNotificationBus::Broadcast(&PlayerIdentityNotifications::OnPlayerNameChanged, GetNetEntityId(), playerName.c_str());
+            } };
         #endif
     };
 
@@ -6,6 +6,7 @@
  */
 
 #include <Source/Components/NetworkAiComponent.h>
+#include <Source/Components/NetworkAiSystem.h>
 #include <Source/Components/NetworkPlayerMovementComponent.h>
 #include <Source/Components/NetworkRandomComponent.h>
 #include <Source/Components/NetworkWeaponsComponent.h>
@@ -23,96 +24,200 @@ namespace MultiplayerSample
     {
 	}
 
+    void NetworkAiComponentController::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
+    {
+#if AZ_TRAIT_SERVER
+        if (GetEnabled())
+        {
+            if (NetworkAiSystem* aiSystem = AZ::Interface<NetworkAiSystem>::Get())
+            {
+                aiSystem->RegisterAi(this);
+                m_registered = true;
+            }
+        }
+#endif
+    }
+
+    void NetworkAiComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
+    {
+#if AZ_TRAIT_SERVER
+        if (m_registered)
+        {
+            if (NetworkAiSystem* aiSystem = AZ::Interface<NetworkAiSystem>::Get())
+            {
+                aiSystem->UnregisterAi(this);
+            }
+            m_registered = false;
+        }
+#endif
+    }
+
 #if AZ_TRAIT_SERVER
     constexpr static float SecondsToMs = 1000.f;
 
-    void NetworkAiComponentController::TickMovement(NetworkPlayerMovementComponentController& movementController, float deltaTime)
+    void NetworkAiComponentController::SetMovementController(NetworkPlayerMovementComponentController* movementController)
+    {
+        m_movementController = movementController;
+    }
+
+    void NetworkAiComponentController::SetWeaponsController(NetworkWeaponsComponentController* weaponsController)
+    {
+        m_weaponsController = weaponsController;
+    }
+
+    void NetworkAiComponentController::GatherThinkState(NetworkAiThinkState& state) const
+    {
+        state.m_fireIntervalMinMs = GetFireIntervalMinMs();
+        state.m_fireIntervalMaxMs = GetFireIntervalMaxMs();
+        state.m_actionIntervalMinMs = GetActionIntervalMinMs();
+        state.m_actionIntervalMaxMs = GetActionIntervalMaxMs();
+
+        state.m_seed = GetNetworkRandomComponentController()->GetSeed();
+        state.m_remainingTimeMs = GetRemainingTimeMs();
+        state.m_turnRate = GetTurnRate();
+        state.m_targetYawDelta = GetTargetYawDelta();
+        state.m_targetPitchDelta = GetTargetPitchDelta();
+        state.m_action = GetAction();
+        state.m_strafingRight = GetStrafingRight();
+        state.m_shotFired = GetShotFired();
+        state.m_timeToNextShot = GetTimeToNextShot();
+
+        state.m_hasMovement = (m_movementController != nullptr);
+        state.m_hasWeapons = (m_weaponsController != nullptr);
+        if (state.m_hasMovement)
+        {
+            state.m_viewYaw = m_movementController->m_viewYaw;
+            state.m_viewPitch = m_movementController->m_viewPitch;
+        }
+        state.m_weaponFiringChanged = false;
+    }
+
+    void NetworkAiComponentController::Think(NetworkAiThinkState& state, float deltaTime)
+    {
+        // Movement is always evaluated before weapons so that both consume the shared random seed in a fixed order
+        const float deltaTimeMs = deltaTime * SecondsToMs;
+        if (state.m_hasMovement)
+        {
+            ThinkMovement(state, deltaTimeMs);
+        }
+        if (state.m_hasWeapons)
+        {
+            ThinkWeapons(state, deltaTimeMs);
+        }
+    }
+
+    void NetworkAiComponentController::ThinkMovement(NetworkAiThinkState& state, float deltaTimeMs)
     {
-        // TODO: Execute this tick only if this component is owned by this endpoint (currently ticks on server only)
-        float deltaTimeMs = deltaTime * SecondsToMs;
-        ModifyRemainingTimeMs() -= deltaTimeMs;
+        state.m_remainingTimeMs -= deltaTimeMs;
 
-        if (GetRemainingTimeMs() <= 0)
+        if (state.m_remainingTimeMs <= 0)
         {
             // Determine a new directive after 500 to 9500 ms
-            SetRemainingTimeMs(GetNetworkRandomComponentController()->GetRandomFloat() * (GetActionIntervalMaxMs() - GetActionIntervalMinMs()) + GetActionIntervalMinMs());
-            SetTurnRate(1.f / GetRemainingTimeMs());
+            state.m_remainingTimeMs = NetworkRandomComponentController::GetRandomFloat(state.m_seed) *
+                (state.m_actionIntervalMaxMs - state.m_actionIntervalMinMs) + state.m_actionIntervalMinMs;
+            state.m_turnRate = 1.f / state.m_remainingTimeMs;
 
             // Randomize new target yaw and pitch and compute the delta from the current yaw and pitch respectively
-            SetTargetYawDelta(-movementController.m_viewYaw + (GetNetworkRandomComponentController()->GetRandomFloat() * 2.f - 1.f));
-            SetTargetPitchDelta(-movementController.m_viewPitch + (GetNetworkRandomComponentController()->GetRandomFloat() - 0.5f));
+            state.m_targetYawDelta = -state.m_viewYaw + (NetworkRandomComponentController::GetRandomFloat(state.m_seed) * 2.f - 1.f);
+            state.m_targetPitchDelta = -state.m_viewPitch + (NetworkRandomComponentController::GetRandomFloat(state.m_seed) - 0.5f);
 
             // Randomize the action and strafe direction (used only if we decide to strafe)
-            SetAction(static_cast<Action>(GetNetworkRandomComponentController()->GetRandomInt() % static_cast<int>(Action::COUNT)));
-            SetStrafingRight(static_cast<bool>(GetNetworkRandomComponentController()->GetRandomInt() % 2));
+            state.m_action = static_cast<Action>(NetworkRandomComponentController::GetRandomInt(state.m_seed) % static_cast<int>(Action::COUNT));
+            state.m_strafingRight = static_cast<bool>(NetworkRandomComponentController::GetRandomInt(state.m_seed) % 2);
         }
 
-        // Translate desired motion into inputs
-
         // Interpolate the current view yaw and pitch values towards the desired values
-        movementController.m_viewYaw += GetTurnRate() * deltaTimeMs * GetTargetYawDelta();
-        movementController.m_viewPitch += GetTurnRate() * deltaTimeMs * GetTargetPitchDelta();
-
-        // Reset keyboard movement inputs decided on the previous frame
-        movementController.m_forwardDown = false;
-        movementController.m_backwardDown = false;
-        movementController.m_leftDown = false;
-        movementController.m_rightDown = false;
-        movementController.m_sprinting = false;
-        movementController.m_jumping = false;
-        movementController.m_crouching = false;
-
-        switch (GetAction())
+        state.m_viewYaw += state.m_turnRate * deltaTimeMs * state.m_targetYawDelta;
+        state.m_viewPitch += state.m_turnRate * deltaTimeMs * state.m_targetPitchDelta;
+    }
+
+    void NetworkAiComponentController::ThinkWeapons(NetworkAiThinkState& state, float deltaTimeMs)
+    {
+        state.m_timeToNextShot -= deltaTimeMs;
+        if (state.m_timeToNextShot <= 0)
         {
-        case Action::Default:
-            movementController.m_forwardDown = true;
-            break;
-        case Action::Sprinting:
-            movementController.m_forwardDown = true;
-            movementController.m_sprinting = true;
-            break;
-        case Action::Jumping:
-            movementController.m_forwardDown = true;
-            movementController.m_jumping = true;
-            break;
-        case Action::Crouching:
-            movementController.m_forwardDown = true;
-            movementController.m_crouching = true;
-            break;
-        case Action::Strafing:
-            if (GetStrafingRight())
+            if (state.m_shotFired)
             {
-                movementController.m_rightDown = true;
+                // Fire weapon between 100 and 10000 ms from now
+                state.m_timeToNextShot = NetworkRandomComponentController::GetRandomFloat(state.m_seed) *
+                    (state.m_fireIntervalMaxMs - state.m_fireIntervalMinMs) + state.m_fireIntervalMinMs;
+                state.m_shotFired = false;
+                state.m_weaponFiring = false;
             }
             else
             {
-                movementController.m_leftDown = true;
+                state.m_weaponFiring = true;
+                state.m_shotFired = true;
             }
-            break;
-        default:
-            break;
+            state.m_weaponFiringChanged = true;
         }
     }
 
-    void NetworkAiComponentController::TickWeapons(NetworkWeaponsComponentController& weaponsController, float deltaTime)
+    void NetworkAiComponentController::ApplyThinkState(const NetworkAiThinkState& state)
     {
-        // TODO: Execute this tick only if this component is owned by this endpoint (currently ticks on server only)
-        ModifyTimeToNextShot() -= deltaTime * SecondsToMs;
-        if (GetTimeToNextShot() <= 0)
+        GetNetworkRandomComponentController()->SetSeed(state.m_seed);
+        SetRemainingTimeMs(state.m_remainingTimeMs);
+        SetTurnRate(state.m_turnRate);
+        SetTargetYawDelta(state.m_targetYawDelta);
+        SetTargetPitchDelta(state.m_targetPitchDelta);
+        SetAction(state.m_action);
+        SetStrafingRight(state.m_strafingRight);
+        SetShotFired(state.m_shotFired);
+        SetTimeToNextShot(state.m_timeToNextShot);
+
+        if (state.m_hasMovement && (m_movementController != nullptr))
         {
-            if (GetShotFired())
-            {
-                // Fire weapon between 100 and 10000 ms from now
-                SetTimeToNextShot(GetNetworkRandomComponentController()->GetRandomFloat() * (GetFireIntervalMaxMs() - GetFireIntervalMinMs()) + GetFireIntervalMinMs());
-                SetShotFired(false);
-                weaponsController.m_weaponFiring = false;
-            }
-            else
+            NetworkPlayerMovementComponentController& movementController = *m_movementController;
+
+            // Translate desired motion into inputs
+            movementController.m_viewYaw = state.m_viewYaw;
+            movementController.m_viewPitch = state.m_viewPitch;
+
+            // Reset keyboard movement inputs decided on the previous frame
+            movementController.m_forwardDown = false;
+            movementController.m_backwardDown = false;
+            movementController.m_leftDown = false;
+            movementController.m_rightDown = false;
+            movementController.m_sprinting = false;
+            movementController.m_jumping = false;
+            movementController.m_crouching = false;
+
+            switch (state.m_action)
             {
-                weaponsController.m_weaponFiring = true;
-                SetShotFired(true);
+            case Action::Default:
+                movementController.m_forwardDown = true;
+                break;
+            case Action::Sprinting:
+                movementController.m_forwardDown = true;
+                movementController.m_sprinting = true;
+                break;
+            case Action::Jumping:
+                movementController.m_forwardDown = true;
+                movementController.m_jumping = true;
+                break;
+            case Action::Crouching:
+                movementController.m_forwardDown = true;
+                movementController.m_crouching = true;
+                break;
+            case Action::Strafing:
+                if (state.m_strafingRight)
+                {
+                    movementController.m_rightDown = true;
+                }
+                else
+                {
+                    movementController.m_leftDown = true;
+                }
+                break;
+            default:
+                break;
             }
         }
+
+        if (state.m_hasWeapons && state.m_weaponFiringChanged && (m_weaponsController != nullptr))
+        {
+            m_weaponsController->m_weaponFiring = state.m_weaponFiring;
+        }
     }
 
     void NetworkAiComponentController::ConfigureAi(
@@ -124,4 +229,4 @@ namespace MultiplayerSample
         SetActionIntervalMaxMs(actionIntervalMaxMs);
     }
 #endif
-}
\ No newline at end of file
+}
@@ -16,6 +16,40 @@ namespace MultiplayerSample
     class NetworkWeaponsComponentController;
     class NetworkPlayerMovementComponentController;
 
+#if AZ_TRAIT_SERVER
+    //! Plain copy of a bot's AI state and the inputs it drives.
+    //! The think phase only reads and writes this struct, so it can run off the main thread without touching
+    //! network properties, EBuses or the random component.
+    struct NetworkAiThinkState
+    {
+        // Configuration
+        float m_fireIntervalMinMs = 0.0f;
+        float m_fireIntervalMaxMs = 0.0f;
+        float m_actionIntervalMinMs = 0.0f;
+        float m_actionIntervalMaxMs = 0.0f;
+
+        // Persistent AI state
+        uint64_t m_seed = 0;
+        float m_remainingTimeMs = 0.0f;
+        float m_turnRate = 0.0f;
+        float m_targetYawDelta = 0.0f;
+        float m_targetPitchDelta = 0.0f;
+        Action m_action = Action::Default;
+        bool m_strafingRight = false;
+        bool m_shotFired = true;
+        float m_timeToNextShot = 0.0f;
+
+        // Synthetic inputs
+        float m_viewYaw = 0.0f;
+        float m_viewPitch = 0.0f;
+        bool m_weaponFiring = false;
+        bool m_weaponFiringChanged = false;
+
+        bool m_hasMovement = false;
+        bool m_hasWeapons = false;
+    };
+#endif
+
     //! The NetworkAiComponent, when active, can execute behaviors and produce synthetic inputs to drive the
     //! NetworkPlayerMovementComponentController and NetworkWeaponsComponentController.
     class NetworkAiComponentController
@@ -24,12 +58,24 @@ namespace MultiplayerSample
     public:
         NetworkAiComponentController(NetworkAiComponent& parent);
 
-        void OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating) override {};
-        void OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating) override {};
+        void OnActivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
+        void OnDeactivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
 
 #if AZ_TRAIT_SERVER
-        void TickMovement(NetworkPlayerMovementComponentController& movementController, float deltaTime);
-        void TickWeapons(NetworkWeaponsComponentController& weaponsController, float deltaTime);
+        //! Sets the controllers driven by this AI, nullptr detaches them.
+        //! @{
+        void SetMovementController(NetworkPlayerMovementComponentController* movementController);
+        void SetWeaponsController(NetworkWeaponsComponentController* weaponsController);
+        //! @}
+
+        //! Copies the current AI state into a plain struct for the think phase. Must be called on the main thread.
+        void GatherThinkState(NetworkAiThinkState& state) const;
+
+        //! Computes the next AI decisions. Only touches the provided state, so this is safe to call from a job.
+        static void Think(NetworkAiThinkState& state, float deltaTime);
+
+        //! Writes the results of the think phase back to network properties and the driven controllers. Must be called on the main thread.
+        void ApplyThinkState(const NetworkAiThinkState& state);
 #endif
 
     private:
@@ -38,6 +84,13 @@ namespace MultiplayerSample
 #if AZ_TRAIT_SERVER
         void ConfigureAi(
             float fireIntervalMinMs, float fireIntervalMaxMs, float actionIntervalMinMs, float actionIntervalMaxMs);
+
+        static void ThinkMovement(NetworkAiThinkState& state, float deltaTimeMs);
+        static void ThinkWeapons(NetworkAiThinkState& state, float deltaTimeMs);
+
+        NetworkPlayerMovementComponentController* m_movementController = nullptr;
+        NetworkWeaponsComponentController* m_weaponsController = nullptr;
+        bool m_registered = false;
 #endif
     };
 }
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Components/NetworkAiSystem.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Time/ITime.h>
+
+namespace MultiplayerSample
+{
+#if AZ_TRAIT_SERVER
+    AZ_CVAR(bool, sv_AiParallelThink, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, AI decisions are computed in parallel jobs before being applied on the main thread");
+    AZ_CVAR(uint32_t, sv_AiThinkBatchSize, 32, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of bots each AI think job processes");
+
+    void NetworkAiSystem::Activate()
+    {
+        AZ::Interface<NetworkAiSystem>::Register(this);
+    }
+
+    void NetworkAiSystem::Deactivate()
+    {
+        m_updateAiEvent.RemoveFromQueue();
+        m_aiControllers.clear();
+        m_thinkStates.clear();
+        AZ::Interface<NetworkAiSystem>::Unregister(this);
+    }
+
+    void NetworkAiSystem::RegisterAi(NetworkAiComponentController* aiController)
+    {
+        m_aiControllers.push_back(aiController);
+        if (!m_updateAiEvent.IsScheduled())
+        {
+            m_updateAiEvent.Enqueue(AZ::TimeMs{ 0 }, true);
+        }
+    }
+
+    void NetworkAiSystem::UnregisterAi(NetworkAiComponentController* aiController)
+    {
+        auto iter = AZStd::find(m_aiControllers.begin(), m_aiControllers.end(), aiController);
+        if (iter != m_aiControllers.end())
+        {
+            // Order doesn't matter, every bot's decisions only depend on its own state
+            *iter = m_aiControllers.back();
+            m_aiControllers.pop_back();
+        }
+
+        if (m_aiControllers.empty())
+        {
+            m_updateAiEvent.RemoveFromQueue();
+        }
+    }
+
+    void NetworkAiSystem::UpdateAi()
+    {
+        const float deltaTime = AZ::TimeMsToSeconds(m_updateAiEvent.TimeInQueueMs());
+        const size_t aiCount = m_aiControllers.size();
+
+        // Gather
+        m_thinkStates.resize(aiCount);
+        for (size_t index = 0; index < aiCount; ++index)
+        {
+            m_aiControllers[index]->GatherThinkState(m_thinkStates[index]);
+        }
+
+        // Think
+        const size_t batchSize = AZStd::max<size_t>(static_cast<uint32_t>(sv_AiThinkBatchSize), 1);
+        if (sv_AiParallelThink && (aiCount > batchSize))
+        {
+            AZ::JobCompletion completion;
+            for (size_t batchStart = 0; batchStart < aiCount; batchStart += batchSize)
+            {
+                const size_t batchEnd = AZStd::min(batchStart + batchSize, aiCount);
+                AZ::Job* job = AZ::CreateJobFunction([this, batchStart, batchEnd, deltaTime]()
+                {
+                    for (size_t index = batchStart; index < batchEnd; ++index)
+                    {
+                        NetworkAiComponentController::Think(m_thinkStates[index], deltaTime);
+                    }
+                }, true);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (NetworkAiThinkState& thinkState : m_thinkStates)
+            {
+                NetworkAiComponentController::Think(thinkState, deltaTime);
+            }
+        }
+
+        // Apply
+        for (size_t index = 0; index < aiCount; ++index)
+        {
+            m_aiControllers[index]->ApplyThinkState(m_thinkStates[index]);
+        }
+    }
+#endif
+}
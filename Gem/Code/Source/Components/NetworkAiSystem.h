@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <Source/Components/NetworkAiComponent.h>
+
+namespace MultiplayerSample
+{
+#if AZ_TRAIT_SERVER
+    //! Updates every active NetworkAiComponent on this server in a single pass.
+    //! Each update gathers the bots' state into a plain array, computes their decisions in parallel jobs, then
+    //! applies the results serially. Each bot only consumes its own NetworkRandomComponent seed, so the results
+    //! are the same regardless of how the think phase is split across jobs.
+    class NetworkAiSystem
+    {
+    public:
+        AZ_RTTI(NetworkAiSystem, "{53C44EE9-4309-4D9E-9A0B-7CB903A356D1}");
+
+        NetworkAiSystem() = default;
+        virtual ~NetworkAiSystem() = default;
+
+        void Activate();
+        void Deactivate();
+
+        void RegisterAi(NetworkAiComponentController* aiController);
+        void UnregisterAi(NetworkAiComponentController* aiController);
+
+    private:
+        void UpdateAi();
+
+        AZStd::vector<NetworkAiComponentController*> m_aiControllers;
+        AZStd::vector<NetworkAiThinkState> m_thinkStates;
+
+        AZ::ScheduledEvent m_updateAiEvent{ [this]()
+        {
+            UpdateAi();
+        }, AZ::Name("NetworkAiSystemUpdate") };
+    };
+#endif
+}
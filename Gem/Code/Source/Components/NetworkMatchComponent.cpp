@@ -6,7 +6,11 @@
  */
 
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
 #include <AzCore/Preprocessor/EnumReflectUtils.h>
+#include <AzCore/std/chrono/chrono.h>
 
 #include <GameplayEffectsNotificationBus.h>
 #include <MultiplayerSampleTypes.h>
@@ -116,13 +120,15 @@ namespace MultiplayerSample
 
 #endif
 
-        // Disable player actions between rounds (rest period)
+        // Disable player actions between rounds (rest period).
+        // Round and rest time are rewindable, so they are read on every call rather than cached.
         if (GetRoundTime() <= 0 && GetRoundRestTimeRemaining() > 0)
         {
             return AllowedPlayerActions::RotationOnly;
         }
 
-        // Disable player actions if the match hasn't started and we're still waiting for more players to join
+        // Disable player actions if the match hasn't started and we're still waiting for more players to join.
+        // Compared on every call, so inputs processed at a rewound host time get the answer for that time.
         if ( AZ::Interface<Multiplayer::IMultiplayer>::Get()->GetCurrentHostTimeMs() < GetMatchStartHostTime())
         {
             return AllowedPlayerActions::RotationOnly;
@@ -256,6 +262,17 @@ namespace MultiplayerSample
                 });
 
             GameState::GameStateRequests::CreateAndPushNewOverridableGameStateOfType<GameStateWaitingForPlayers>();
+
+            m_coinsChangedHandler = AZ::Event<int32_t, PlayerCoinState>::Handler([this](int32_t, PlayerCoinState coinState)
+                {
+                    const auto registryIterator = m_playerRegistry.find(coinState.m_playerId);
+                    if (registryIterator != m_playerRegistry.end())
+                    {
+                        RegisteredPlayer& player = registryIterator->second;
+                        UpdatePlayerRank(player, coinState.m_coins, player.m_rank.m_armor);
+                    }
+                });
+            GetMatchPlayerCoinsComponentController()->GetParent().CoinsPerPlayerAddEvent(m_coinsChangedHandler);
         #endif
 
         PlayerMatchLifecycleBus::Handler::BusConnect();
@@ -275,6 +292,11 @@ namespace MultiplayerSample
 
         m_roundTickEvent.RemoveFromQueue();
         m_restTickEvent.RemoveFromQueue();
+
+        m_coinsChangedHandler.Disconnect();
+        m_playerRegistry.clear();
+        m_playerRanking.clear();
+        m_players.clear();
 #endif
     }
 
@@ -296,73 +318,28 @@ namespace MultiplayerSample
         m_restTickEvent.RemoveFromQueue();
 
         MatchResultsSummary results;
+        results.m_playerStates.reserve(m_playerRanking.size());
 
-        const AZStd::vector<PlayerCoinState>& coinStates = GetMatchPlayerCoinsComponentController()->GetParent().
-            GetPlayerCoinCounts();
-
-        int highestCoins = -1;
-
-        AZStd::vector<PlayerState> potentialWinners;
-
-        for (const Multiplayer::NetEntityId playerNetEntity : m_players)
+        // The ranking is already ordered by score (highest score is 1st), then by remaining armor
+        for (const PlayerRank& rank : m_playerRanking)
         {
-            PlayerState state;
-            const auto playerHandle = Multiplayer::GetNetworkEntityManager()->GetEntity(playerNetEntity);
-            if (playerHandle.Exists())
-            {
-                if (PlayerIdentityComponent* identity = playerHandle.GetEntity()->FindComponent<PlayerIdentityComponent>())
-                {
-                    state.m_playerName = identity->GetPlayerName();
-                    RespawnPlayer(playerNetEntity, PlayerResetOptions{ true, 100 });
-                }
-                if (const NetworkHealthComponent* armor = playerHandle.GetEntity()->FindComponent<NetworkHealthComponent>())
-                {
-                    // Treating health as armor
-                    state.m_remainingArmor = aznumeric_cast<uint8_t>(armor->GetHealth());
-                }
-            }
-            else
+            const auto playerHandle = Multiplayer::GetNetworkEntityManager()->GetEntity(rank.m_playerId);
+            if (!playerHandle.Exists())
             {
                 continue;
             }
 
-            const auto coinStateIterator = AZStd::find_if(coinStates.begin(), coinStates.end(), [playerNetEntity](const PlayerCoinState& state)
-                {
-                    return state.m_playerId == playerNetEntity;
-                });
-            if (coinStateIterator != coinStates.end())
+            PlayerState state;
+            if (const PlayerIdentityComponent* identity = playerHandle.GetEntity()->FindComponent<PlayerIdentityComponent>())
             {
-                state.m_score = coinStateIterator->m_coins;
-                if (highestCoins < aznumeric_cast<int>(state.m_score))
-                {
-                    highestCoins = aznumeric_cast<int>(state.m_score);
-
-                    // There is no tie so far.
-                    potentialWinners.clear();
-                    potentialWinners.push_back(state);
-                }
-                else if (highestCoins == aznumeric_cast<int>(state.m_score))
-                {
-                    // A potential tie - decide based on remaining armor later.
-                    potentialWinners.push_back(state);                    
-                }
+                state.m_playerName = identity->GetPlayerName();
             }
-
+            state.m_score = rank.m_coins;
+            state.m_remainingArmor = rank.m_armor;
             results.m_playerStates.push_back(state);
         }
 
         // Print the player results to server.log for tracking tournament winners.
-        // Sort the players by score (highest score is 1st)
-        // If scores are matching, then sort by remaining armor.
-        AZStd::sort(results.m_playerStates.begin(), results.m_playerStates.end(), [](const PlayerState& a, const PlayerState& b)
-            {
-                if (a.m_score == b.m_score)
-                {
-                    return a.m_remainingArmor > b.m_remainingArmor;
-                }
-                return a.m_score > b.m_score;
-            });
-
         AZStd::string prettyPrintMatchResults = "";
         prettyPrintMatchResults += AZStd::string::format("Match Results (%lu players)\n", results.m_playerStates.size());
         for (const PlayerState& playerState : results.m_playerStates)
@@ -371,56 +348,133 @@ namespace MultiplayerSample
         }
         AZ_Info("NetworkMatchComponentController", prettyPrintMatchResults.c_str());
 
+        FindWinner(results);
 
-        FindWinner(results, potentialWinners);
+        // Reset players only after the results are captured, since resetting changes their ranking
+        for (const Multiplayer::NetEntityId playerNetEntity : m_players)
+        {
+            RespawnPlayer(playerNetEntity, PlayerResetOptions{ true, 100 });
+        }
 
         RPC_EndMatch(results);
         GetMatchPlayerCoinsComponentController()->ResetAllCoins();
     }
-#endif
 
-    void NetworkMatchComponentController::FindWinner(MatchResultsSummary& results,
-        const AZStd::vector<PlayerState>& potentialWinners)
+    void NetworkMatchComponentController::FindWinner(MatchResultsSummary& results)
     {
-        if (potentialWinners.empty())
+        if (results.m_playerStates.empty())
         {
             results.m_winningPlayerName = "No players in the match";
+            return;
+        }
+
+        // Player states are sorted, so any players tied with the leader on both score and armor directly follow it
+        const PlayerState& leader = results.m_playerStates.front();
+        size_t tiedPlayerCount = 1;
+        while (tiedPlayerCount < results.m_playerStates.size()
+            && results.m_playerStates[tiedPlayerCount].m_score == leader.m_score
+            && results.m_playerStates[tiedPlayerCount].m_remainingArmor == leader.m_remainingArmor)
+        {
+            ++tiedPlayerCount;
         }
-        else if (potentialWinners.size() == 1)
+
+        if (tiedPlayerCount > 1)
         {
-            results.m_winningPlayerName = potentialWinners.front().m_playerName;
+            // If multiple players are still tied on armor, randomly choose a player
+            const AZ::u64 randomlyChosenWinnerIndex = GetNetworkRandomComponentController()->GetRandomUint64() % tiedPlayerCount;
+            results.m_winningPlayerName = results.m_playerStates[randomlyChosenWinnerIndex].m_playerName;
         }
-        else if (potentialWinners.size() > 1)
+        else
         {
-            // A tie - find the player with the largest armor remaining.
-            AZStd::vector<const PlayerState*> playersTiedByArmor;
-            playersTiedByArmor.push_back(&potentialWinners.front());
+            results.m_winningPlayerName = leader.m_playerName;
+        }
+    }
 
-            for (const PlayerState& potential : potentialWinners)
-            {
-                if (potential.m_remainingArmor == playersTiedByArmor.front()->m_remainingArmor)
-                {
-                    playersTiedByArmor.push_back(&potential);
-                }
-                else if (potential.m_remainingArmor > playersTiedByArmor.front()->m_remainingArmor)
-                {
-                    playersTiedByArmor.clear();
-                    playersTiedByArmor.push_back(&potential);
-                }
-            }
+    bool NetworkMatchComponentController::PlayerRank::operator<(const PlayerRank& rhs) const
+    {
+        if (m_coins != rhs.m_coins)
+        {
+            return m_coins > rhs.m_coins;
+        }
+        if (m_armor != rhs.m_armor)
+        {
+            return m_armor > rhs.m_armor;
+        }
+        return m_playerId < rhs.m_playerId;
+    }
 
-            if (playersTiedByArmor.size() > 1)
+    void NetworkMatchComponentController::RegisterPlayer(Multiplayer::NetEntityId playerEntity)
+    {
+        RegisteredPlayer& player = m_playerRegistry[playerEntity];
+        player.m_slot = m_players.size();
+        player.m_rank.m_playerId = playerEntity;
+        m_players.push_back(playerEntity);
+
+        // Seed the rank with whatever the player already has; change events keep it current from here on
+        const AZStd::span<const PlayerCoinState> coinStates = GetMatchPlayerCoinsComponentController()->GetParent().GetPlayerCoinCounts().m_coins;
+        const auto coinStateIterator = AZStd::find_if(coinStates.begin(), coinStates.end(), [playerEntity](const PlayerCoinState& state)
             {
-                // If multiple players are still tied on armor, randomly choose a player
-                const AZ::u64 randomlyChosenWinnerIndex = GetNetworkRandomComponentController()->GetRandomUint64() % playersTiedByArmor.size();
-                results.m_winningPlayerName = playersTiedByArmor[randomlyChosenWinnerIndex]->m_playerName;
-            }
-            else
+                return state.m_playerId == playerEntity;
+            });
+        if (coinStateIterator != coinStates.end())
+        {
+            player.m_rank.m_coins = coinStateIterator->m_coins;
+        }
+
+        const auto playerHandle = Multiplayer::GetNetworkEntityManager()->GetEntity(playerEntity);
+        if (playerHandle.Exists())
+        {
+            if (NetworkHealthComponent* armor = playerHandle.GetEntity()->FindComponent<NetworkHealthComponent>())
             {
-                results.m_winningPlayerName = playersTiedByArmor.front()->m_playerName;
+                // Treating health as armor
+                player.m_rank.m_armor = aznumeric_cast<uint8_t>(armor->GetHealth());
+                player.m_armorChangedHandler = AZ::Event<float>::Handler([this, &player](float health)
+                    {
+                        UpdatePlayerRank(player, player.m_rank.m_coins, aznumeric_cast<uint8_t>(health));
+                    });
+                armor->HealthAddEvent(player.m_armorChangedHandler);
             }
         }
+
+        m_playerRanking.insert(player.m_rank);
+    }
+
+    bool NetworkMatchComponentController::UnregisterPlayer(Multiplayer::NetEntityId playerEntity)
+    {
+        const auto registryIterator = m_playerRegistry.find(playerEntity);
+        if (registryIterator == m_playerRegistry.end())
+        {
+            return false;
+        }
+
+        // Swap-remove from the dense list and patch the slot of the player that moved
+        const size_t slot = registryIterator->second.m_slot;
+        const Multiplayer::NetEntityId movedPlayer = m_players.back();
+        m_players[slot] = movedPlayer;
+        m_players.pop_back();
+        if (movedPlayer != playerEntity)
+        {
+            m_playerRegistry[movedPlayer].m_slot = slot;
+        }
+
+        m_playerRanking.erase(registryIterator->second.m_rank);
+        m_playerRegistry.erase(registryIterator);
+        return true;
+    }
+
+    void NetworkMatchComponentController::UpdatePlayerRank(RegisteredPlayer& player, uint32_t coins, uint8_t armor)
+    {
+        if (player.m_rank.m_coins == coins && player.m_rank.m_armor == armor)
+        {
+            return;
+        }
+
+        m_playerRanking.erase(player.m_rank);
+        player.m_rank.m_coins = coins;
+        player.m_rank.m_armor = armor;
+        m_playerRanking.insert(player.m_rank);
     }
+#endif
 
 #if AZ_TRAIT_SERVER
     void NetworkMatchComponentController::StartRound()
@@ -482,10 +536,9 @@ namespace MultiplayerSample
     void NetworkMatchComponentController::HandleRPC_PlayerActivated([[maybe_unused]] AzNetworking::IConnection* invokingConnection,
         const Multiplayer::NetEntityId& playerEntity)
     {
-        const auto playerIterator = AZStd::find(m_players.begin(), m_players.end(), playerEntity);
-        if (playerIterator == m_players.end())
+        if (m_playerRegistry.find(playerEntity) == m_playerRegistry.end())
         {
-            m_players.push_back(playerEntity);
+            RegisterPlayer(playerEntity);
             AssignPlayerIdentity(playerEntity);
         }
         SetPlayerCount(aznumeric_cast<int16_t>(m_players.size()));
@@ -494,12 +547,7 @@ namespace MultiplayerSample
     void NetworkMatchComponentController::HandleRPC_PlayerDeactivated([[maybe_unused]] AzNetworking::IConnection* invokingConnection,
         const Multiplayer::NetEntityId& playerEntity)
     {
-        const auto playerIterator = AZStd::find(m_players.begin(), m_players.end(), playerEntity);
-        if (playerIterator != m_players.end())
-        {
-            m_players.erase(playerIterator);
-        }
-        else
+        if (!UnregisterPlayer(playerEntity))
         {
             AZ_Warning("NetworkMatchComponentController", false, "An unknown player deactivated %llu", aznumeric_cast<AZ::u64>(playerEntity));
         }
@@ -510,8 +558,7 @@ namespace MultiplayerSample
     void NetworkMatchComponentController::OnPlayerArmorZero([[maybe_unused]] Multiplayer::NetEntityId playerEntity)
     {
 #if AZ_TRAIT_SERVER
-        const auto playerIterator = AZStd::find(m_players.begin(), m_players.end(), playerEntity);
-        if (playerIterator != m_players.end())
+        if (m_playerRegistry.find(playerEntity) != m_playerRegistry.end())
         {
             if (Multiplayer::ConstNetworkEntityHandle playerHandle = Multiplayer::GetNetworkEntityManager()->GetEntity(playerEntity))
             {
@@ -525,8 +572,8 @@ namespace MultiplayerSample
 
                     if (gemSpawnerComponent)
                     {
-                        const AZStd::vector<PlayerCoinState>& coinStates = GetMatchPlayerCoinsComponentController()->GetParent().
-                            GetPlayerCoinCounts();
+                        const AZStd::span<const PlayerCoinState> coinStates = GetMatchPlayerCoinsComponentController()->GetParent().
+                            GetPlayerCoinCounts().m_coins;
 
                         const auto coinStateIterator = AZStd::find_if(
                             coinStates.begin(), coinStates.end(), [playerEntity](const PlayerCoinState& state)
@@ -648,4 +695,53 @@ namespace MultiplayerSample
         }
     }
 #endif
+
+    static void BenchmarkPlayerActionsAllowed(const AZ::ConsoleCommandContainer& arguments)
+    {
+        uint32_t playerCount = 10;
+        uint32_t botCount = 100;
+        uint32_t seconds = 10;
+        if (arguments.size() > 0)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(playerCount, arguments[0]);
+        }
+        if (arguments.size() > 1)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(botCount, arguments[1]);
+        }
+        if (arguments.size() > 2)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(seconds, arguments[2]);
+        }
+
+        const INetworkMatch* networkMatch = AZ::Interface<INetworkMatch>::Get();
+        if (!networkMatch)
+        {
+            AZLOG_WARN("BenchmarkPlayerActionsAllowed needs a loaded level with a NetworkMatchComponent");
+            return;
+        }
+
+        AZ::TimeMs inputRateMs = AZ::TimeMs{ 33 };
+        AZ::Interface<AZ::IConsole>::Get()->GetCvarValue("cl_InputRateMs", inputRateMs);
+        const uint64_t inputsPerSecond = 1000 / AZStd::max(static_cast<uint64_t>(inputRateMs), uint64_t{ 1 });
+
+        // Movement and weapons each ask once per input
+        const uint64_t callCount = uint64_t{ 2 } * (playerCount + botCount) * inputsPerSecond * seconds;
+        uint64_t allowedCount = 0;
+        const auto startTime = AZStd::chrono::steady_clock::now();
+        for (uint64_t call = 0; call < callCount; ++call)
+        {
+            allowedCount += (networkMatch->PlayerActionsAllowed() == AllowedPlayerActions::All) ? 1 : 0;
+        }
+        const double totalUs = static_cast<double>(
+            AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - startTime).count()) / 1000.0;
+
+        AZLOG_INFO("PlayerActionsAllowed benchmark, %u players and %u bots at %llu inputs per second for %u s: "
+            "%llu calls, %.2f ns per call, %.3f us per second of play (%llu allowed)",
+            playerCount, botCount, static_cast<unsigned long long>(inputsPerSecond), seconds,
+            static_cast<unsigned long long>(callCount), totalUs * 1000.0 / AZStd::max(static_cast<double>(callCount), 1.0),
+            totalUs / AZStd::max(static_cast<double>(seconds), 1.0), static_cast<unsigned long long>(allowedCount));
+    }
+    AZ_CONSOLEFREEFUNC(BenchmarkPlayerActionsAllowed, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Benchmarks NetworkMatchComponent::PlayerActionsAllowed at input rate, takes a player count, bot count and seconds of play (defaults to 10, 100 and 10)");
 }
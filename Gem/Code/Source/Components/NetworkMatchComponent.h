@@ -11,6 +11,8 @@
 #include <PlayerMatchLifecycleBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <Source/AutoGen/NetworkMatchComponent.AutoComponent.h>
 
 namespace MultiplayerSample
@@ -175,9 +177,45 @@ namespace MultiplayerSample
         }, AZ::Name("NetworkMatchRestClock") };
 #endif
 
-        //! List of active players in the match.
+        //! List of active players in the match, densely packed for iteration.
         AZStd::vector<Multiplayer::NetEntityId> m_players;
 
+#if AZ_TRAIT_SERVER
+        //! Coins and armor of a player, ordered so the best placed player sorts first.
+        struct PlayerRank
+        {
+            uint32_t m_coins = 0;
+            uint8_t m_armor = 0;
+            Multiplayer::NetEntityId m_playerId = Multiplayer::InvalidNetEntityId;
+
+            bool operator<(const PlayerRank& rhs) const;
+        };
+
+        struct RegisteredPlayer
+        {
+            size_t m_slot = 0; //!< Index into m_players
+            PlayerRank m_rank;
+            AZ::Event<float>::Handler m_armorChangedHandler;
+        };
+
+        //! Adds a player to m_players, the registry and the ranking; O(1) apart from the O(log n) ranking insert.
+        void RegisterPlayer(Multiplayer::NetEntityId playerEntity);
+
+        //! Removes a player by swapping the last player into its slot.
+        //! @return false if the player wasn't registered
+        bool UnregisterPlayer(Multiplayer::NetEntityId playerEntity);
+
+        void UpdatePlayerRank(RegisteredPlayer& player, uint32_t coins, uint8_t armor);
+
+        // Node based so the armor handlers stay in place while other players join or leave
+        AZStd::unordered_map<Multiplayer::NetEntityId, RegisteredPlayer> m_playerRegistry;
+
+        //! Players ordered by coins then armor, kept up to date as the values change so the leader is always at begin()
+        AZStd::set<PlayerRank> m_playerRanking;
+
+        AZ::Event<int32_t, PlayerCoinState>::Handler m_coinsChangedHandler;
+#endif
+
 #if AZ_TRAIT_SERVER
         //! A temporary way to assign player identities, such as player names.
         void AssignPlayerIdentity(Multiplayer::NetEntityId playerEntity);
@@ -189,7 +227,10 @@ namespace MultiplayerSample
         void RespawnPlayer(Multiplayer::NetEntityId playerEntity, PlayerResetOptions resets);
 #endif
 
-        void FindWinner(MatchResultsSummary& results, const AZStd::vector<PlayerState>& potentialWinners);
+#if AZ_TRAIT_SERVER
+        //! Picks the winner from player states sorted by score and remaining armor, breaking exact ties randomly.
+        void FindWinner(MatchResultsSummary& results);
+#endif
     };
 }
 
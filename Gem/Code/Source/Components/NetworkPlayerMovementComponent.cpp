@@ -12,7 +12,17 @@
 #include <Source/Components/NetworkAnimationComponent.h>
 #include <Source/Components/NetworkMatchComponent.h>
 #include <Source/Components/NetworkSimplePlayerCameraComponent.h>
+#include <Source/GameplayTrace.h>
+#include <Source/Replay/ServerInputRecorder.h>
 #include <Multiplayer/Components/NetworkTransformComponent.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
+#include <Multiplayer/NetworkInput/NetworkInput.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/Time/ITime.h>
 #include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Physics/SystemBus.h>
@@ -43,6 +53,11 @@ namespace MultiplayerSample
      */
     AZ_CVAR(float, cl_MaxMouseDelta, 128.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The sum of mouse deltas will be clamped to this maximum");
 
+    AZ_CVAR(bool, mps_movementInputStats, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, periodically logs the cost of processing player movement inputs, including inputs replayed after corrections");
+    AZ_CVAR(AZ::TimeMs, mps_movementInputStatsIntervalMs, AZ::TimeMs{ 5000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "The interval between movement input stat reports");
+    AZ_CVAR(bool, mps_movementCachedCharacterQueries, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, movement input processing queries the character controller through the handler cached on activation instead of an EBus dispatch per query");
+
 #if AZ_TRAIT_CLIENT
     AZ_CVAR(bool, mps_botMode, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, enable bot (AI) mode for client.");
     AZ_CVAR(float, mps_botMinInterval, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The minimum amount of time between bot control updates");
@@ -51,9 +66,6 @@ namespace MultiplayerSample
 
     NetworkPlayerMovementComponentController::NetworkPlayerMovementComponentController(NetworkPlayerMovementComponent& parent)
         : NetworkPlayerMovementComponentControllerBase(parent)
-#if AZ_TRAIT_SERVER		
-        , m_updateAI{ [this] { UpdateAI(); }, AZ::Name{ "MovementControllerAi" } }
-#endif
 #if AZ_TRAIT_CLIENT
     , m_updateLocalBot{ [this] { UpdateLocalBot(); }, AZ::Name{ "MovementControllerLocalBot" } }
 #endif
@@ -68,8 +80,9 @@ namespace MultiplayerSample
         m_aiEnabled = (networkAiComponent != nullptr) ? networkAiComponent->GetEnabled() : false;
         if (m_aiEnabled)
         {
-            m_updateAI.Enqueue(AZ::TimeMs{ 0 }, true);
+            // The NetworkAiSystem drives our inputs from here on
             m_networkAiComponentController = GetNetworkAiComponentController();
+            m_networkAiComponentController->SetMovementController(this);
         }
 #endif
 
@@ -114,12 +127,23 @@ namespace MultiplayerSample
 
     void NetworkPlayerMovementComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+#if AZ_TRAIT_SERVER
+        if (m_networkAiComponentController != nullptr)
+        {
+            m_networkAiComponentController->SetMovementController(nullptr);
+            m_networkAiComponentController = nullptr;
+        }
+#endif
+
 #if AZ_TRAIT_CLIENT
         if (IsNetEntityRoleAutonomous() && !mps_botMode)
         {
             StartingPointInput::InputEventNotificationBus::MultiHandler::BusDisconnect();
         }
 #endif
+
+        Physics::CharacterNotificationBus::Handler::BusDisconnect();
+        m_characterGameplayRequests = nullptr;
     }
 
     void NetworkPlayerMovementComponentController::OnCharacterActivated([[maybe_unused]] const AZ::EntityId& entityId)
@@ -127,8 +151,12 @@ namespace MultiplayerSample
         // Wait until the character is activated before requesting its parameters.
         Physics::CharacterRequestBus::EventResult(m_stepHeight, GetEntityId(), &Physics::CharacterRequestBus::Events::GetStepHeight);
         PhysX::CharacterControllerRequestBus::EventResult(m_radius, GetEntityId(), &PhysX::CharacterControllerRequestBus::Events::GetRadius);
-        PhysX::CharacterGameplayRequestBus::EventResult(
-            m_gravityMultiplier, GetEntityId(), &PhysX::CharacterGameplayRequestBus::Events::GetGravityMultiplier);
+
+        m_characterGameplayRequests = PhysX::CharacterGameplayRequestBus::FindFirstHandler(GetEntityId());
+        if (m_characterGameplayRequests != nullptr)
+        {
+            m_gravityMultiplier = m_characterGameplayRequests->GetGravityMultiplier();
+        }
 
         Physics::CharacterNotificationBus::Handler::BusDisconnect();
     }
@@ -193,6 +221,18 @@ namespace MultiplayerSample
         // reset jumping until next press. We only track when the jump is initially pressed, not that it's being held.
         m_jumping = false;
 
+        if (mps_movementInputStats)
+        {
+            // Everything processed past the new input since the last CreateInput() was a replay
+            if (m_inputStats.m_inputsSinceCreate > 1)
+            {
+                const uint32_t replayDepth = m_inputStats.m_inputsSinceCreate - 1;
+                m_inputStats.m_replayedInputs += replayDepth;
+                m_inputStats.m_maxReplayDepth = AZStd::max(m_inputStats.m_maxReplayDepth, replayDepth);
+            }
+            m_inputStats.m_inputsSinceCreate = 0;
+        }
+
         // Just a note for anyone who is super confused by this, ResetCount is a predictable network property, it gets set on the client
         // through correction packets
         playerInput->m_resetCount = GetNetworkTransformComponentController()->GetResetCount();
@@ -210,30 +250,54 @@ namespace MultiplayerSample
             return;
         }
 
+#if AZ_TRAIT_SERVER
+        if (IsNetEntityRoleAuthority())
+        {
+            // The single recording point for an entity's inputs, so a replay only sees inputs that passed the reset count check
+            if (ServerInputRecorder* recorder = AZ::Interface<ServerInputRecorder>::Get())
+            {
+                recorder->RecordInput(GetNetEntityId(), input, deltaTime);
+            }
+        }
+#endif
+
+        if (mps_movementInputStats)
+        {
+            const AZ::TimeUs startTime = AZ::GetElapsedTimeUs();
+            ProcessMovementInput(*playerInput, input, deltaTime);
+            UpdateInputStats(AZ::GetElapsedTimeUs() - startTime);
+        }
+        else
+        {
+            ProcessMovementInput(*playerInput, input, deltaTime);
+        }
+    }
+
+    void NetworkPlayerMovementComponentController::ProcessMovementInput(
+        NetworkPlayerMovementComponentNetworkInput& playerInput, Multiplayer::NetworkInput& input, float deltaTime)
+    {
         NetworkWeaponsComponentNetworkInput* weaponInput = input.FindComponentInput<NetworkWeaponsComponentNetworkInput>();
         if ((weaponInput != nullptr) && weaponInput->m_firing.AnySet())
         {
             // Note that weaponInput is not guaranteed to exist, so we have to check for nullptr
             // Don't allow sprinting when the character is trying to shoot
-            playerInput->m_sprint = false;
+            playerInput.m_sprint = false;
         }
 
         const bool wasOnGround = GetWasOnGround();
-        bool onGround = GetOnGround();
-
         // Update the "on ground" state for the character.
-        PhysX::CharacterGameplayRequestBus::EventResult(onGround, GetEntityId(), &PhysX::CharacterGameplayRequestBus::Events::IsOnGround);
+        bool onGround = IsCharacterOnGround();
         SetOnGround(onGround);
 
         // Track timers for how recently it's been since the player was on the ground and how recently they pressed the jump button.
         // These will be compared against "slop factors" to allow for a little bit of leniency in jumping to make it feel more reactive.
         SetSecondsSinceOnGround(onGround ? 0.0f : (GetSecondsSinceOnGround() + deltaTime));
-        SetSecondsSinceJumpRequest(playerInput->m_jump ? 0.0f : (GetSecondsSinceJumpRequest() + deltaTime));
+        SetSecondsSinceJumpRequest(playerInput.m_jump ? 0.0f : (GetSecondsSinceJumpRequest() + deltaTime));
 
         // Update orientation
         AZ::Vector3 aimAngles = GetNetworkSimplePlayerCameraComponentController()->GetAimAngles();
-        aimAngles.SetZ(NormalizeHeading(aimAngles.GetZ() - playerInput->m_viewYaw * cl_AimStickScaleZ * cl_MaxMouseDelta));
-        aimAngles.SetX(NormalizeHeading(aimAngles.GetX() - playerInput->m_viewPitch * cl_AimStickScaleX * cl_MaxMouseDelta));
+        aimAngles.SetZ(NormalizeHeading(aimAngles.GetZ() - playerInput.m_viewYaw * cl_AimStickScaleZ * cl_MaxMouseDelta));
+        aimAngles.SetX(NormalizeHeading(aimAngles.GetX() - playerInput.m_viewPitch * cl_AimStickScaleX * cl_MaxMouseDelta));
         aimAngles.SetX(NormalizeHeading(AZ::GetClamp(aimAngles.GetX(), -AZ::Constants::QuarterPi * 1.5f, AZ::Constants::QuarterPi * 1.5f)));
         GetNetworkSimplePlayerCameraComponentController()->SetAimAngles(aimAngles);
 
@@ -243,12 +307,14 @@ namespace MultiplayerSample
         // Update velocity
         bool jumpTriggered = false;
         bool movingDownward = false;
-        UpdateVelocity(*playerInput, deltaTime, jumpTriggered, movingDownward);
+        UpdateVelocity(playerInput, deltaTime, jumpTriggered, movingDownward);
 
         // absolute velocity is based on velocity generated by the player and other sources
         const AZ::Vector3 absoluteVelocity = GetVelocityFromExternalSources() + GetSelfGeneratedVelocity();
 
         GetNetworkCharacterComponentController()->TryMoveWithVelocity(absoluteVelocity, deltaTime);
+        MPS_TRACE(Verbose, MovementInput, GetNetEntityId(), input.GetClientInputId(),
+            absoluteVelocity.GetX(), absoluteVelocity.GetY(), absoluteVelocity.GetZ());
 
         // If a jump was triggered, reset our jump request time to our "slop threshold" so that we don't double-count the jump request
         // if we land too quickly.
@@ -258,9 +324,9 @@ namespace MultiplayerSample
         }
 
         // Tell the camera whether or not we're sprinting
-        GetNetworkSimplePlayerCameraComponentController()->SetSprintMode(playerInput->m_sprint);
-        GetNetworkAnimationComponentController()->ModifyActiveAnimStates().SetBit(aznumeric_cast<uint32_t>(CharacterAnimState::Sprinting), playerInput->m_sprint);
-        GetNetworkAnimationComponentController()->ModifyActiveAnimStates().SetBit(aznumeric_cast<uint32_t>(CharacterAnimState::Crouching), playerInput->m_crouch);
+        GetNetworkSimplePlayerCameraComponentController()->SetSprintMode(playerInput.m_sprint);
+        GetNetworkAnimationComponentController()->ModifyActiveAnimStates().SetBit(aznumeric_cast<uint32_t>(CharacterAnimState::Sprinting), playerInput.m_sprint);
+        GetNetworkAnimationComponentController()->ModifyActiveAnimStates().SetBit(aznumeric_cast<uint32_t>(CharacterAnimState::Crouching), playerInput.m_crouch);
 
         // The Landing anim state will automatically turn off after it's triggered
         GetNetworkAnimationComponentController()->ModifyActiveAnimStates().SetBit(aznumeric_cast<uint32_t>(CharacterAnimState::Landing), onGround && !wasOnGround && !jumpTriggered);
@@ -274,7 +340,7 @@ namespace MultiplayerSample
 
         // If we're still on the ground, then zero out our velocity from external forces
         // This prevents us from sliding along the ground after we land
-        PhysX::CharacterGameplayRequestBus::EventResult(onGround, GetEntityId(), &PhysX::CharacterGameplayRequestBus::Events::IsOnGround);
+        onGround = IsCharacterOnGround();
         if (onGround)
         {
             SetVelocityFromExternalSources(AZ::Vector3::CreateZero());
@@ -284,7 +350,196 @@ namespace MultiplayerSample
         SetWasOnGround(onGround);
     }
 
+    void NetworkPlayerMovementComponentController::UpdateInputStats(AZ::TimeUs processTime)
+    {
+        // Only autonomous clients call CreateInput() for this entity, anywhere else the count would never reset
+        if (IsNetEntityRoleAutonomous())
+        {
+            ++m_inputStats.m_inputsSinceCreate;
+        }
+        ++m_inputStats.m_processedInputs;
+        m_inputStats.m_processTime += processTime;
+
+        if (m_inputStatsReport.ShouldReport(mps_movementInputStatsIntervalMs))
+        {
+            const double processTimeUs = static_cast<double>(m_inputStats.m_processTime);
+            const double usPerInput = processTimeUs / m_inputStats.m_processedInputs;
+            const double inputsPerMs = (processTimeUs > 0.0) ? (m_inputStats.m_processedInputs * 1000.0 / processTimeUs) : 0.0;
+            AZLOG_INFO(
+                "Movement inputs for entity %s: %u processed, %u replayed (max replay depth %u), %.3f us per input, %.1f inputs per ms",
+                GetEntity()->GetName().c_str(), m_inputStats.m_processedInputs, m_inputStats.m_replayedInputs,
+                m_inputStats.m_maxReplayDepth, usPerInput, inputsPerMs);
+
+            // Keep the count since the last CreateInput() so the current replay depth isn't lost across reports
+            const uint32_t inputsSinceCreate = m_inputStats.m_inputsSinceCreate;
+            m_inputStats = InputStats();
+            m_inputStats.m_inputsSinceCreate = inputsSinceCreate;
+        }
+    }
+
 #if AZ_TRAIT_SERVER
+    //! A player spawned for the movement benchmarks, with one input that gets replayed through it.
+    struct MovementBenchmarkPlayer
+    {
+        Multiplayer::NetworkEntityHandle m_player;
+        Multiplayer::NetBindComponent* m_netBindComponent = nullptr;
+        Multiplayer::NetworkTransformComponentController* m_transformController = nullptr;
+        Multiplayer::NetworkInput m_input;
+        NetworkPlayerMovementComponentNetworkInput* m_movementInput = nullptr;
+        Multiplayer::ClientInputId m_clientInputId = Multiplayer::ClientInputId{ 0 };
+        float m_deltaTime = 0.0f;
+    };
+
+    static bool SpawnMovementBenchmarkPlayer(MovementBenchmarkPlayer& benchmarkPlayer, const char* benchmarkName)
+    {
+        static Multiplayer::PrefabEntityId prefabId(AZ::Name{ "prefabs/player.network.spawnable" });
+
+        Multiplayer::INetworkEntityManager* networkEntityManager = Multiplayer::GetNetworkEntityManager();
+        Multiplayer::INetworkEntityManager::EntityList entityList = networkEntityManager->CreateEntitiesImmediate(
+            prefabId, Multiplayer::NetEntityRole::Authority, AZ::Transform::CreateIdentity(), Multiplayer::AutoActivate::Activate);
+        if (entityList.empty())
+        {
+            AZLOG_WARN("%s failed to spawn a player, it needs a loaded level", benchmarkName);
+            return false;
+        }
+
+        benchmarkPlayer.m_player = entityList[0];
+        benchmarkPlayer.m_netBindComponent = benchmarkPlayer.m_player.GetNetBindComponent();
+        benchmarkPlayer.m_transformController = benchmarkPlayer.m_player.FindController<Multiplayer::NetworkTransformComponentController>();
+        if (!benchmarkPlayer.m_netBindComponent || !benchmarkPlayer.m_transformController)
+        {
+            AZLOG_WARN("%s spawned a player without a NetBindComponent or NetworkTransformComponent", benchmarkName);
+            networkEntityManager->MarkForRemoval(benchmarkPlayer.m_player);
+            return false;
+        }
+
+        AZ::TimeMs inputRateMs = AZ::TimeMs{ 33 };
+        AZ::Interface<AZ::IConsole>::Get()->GetCvarValue("cl_InputRateMs", inputRateMs);
+        benchmarkPlayer.m_deltaTime = AZ::TimeMsToSeconds(inputRateMs);
+
+        // Walk and turn, alternating direction between replays so the player stays near its spawn point
+        benchmarkPlayer.m_input.AttachNetBindComponent(benchmarkPlayer.m_netBindComponent);
+        benchmarkPlayer.m_movementInput = benchmarkPlayer.m_input.FindComponentInput<NetworkPlayerMovementComponentNetworkInput>();
+        benchmarkPlayer.m_movementInput->m_viewYaw = MouseAxis(0.1f);
+        return true;
+    }
+
+    //! Replays depth inputs through the player, iterations times, the way a client replays its input history after a correction.
+    //! Returns the time spent processing inputs and adds the bytes allocated while doing so.
+    static AZStd::chrono::steady_clock::duration ReplayMovementInputs(
+        MovementBenchmarkPlayer& benchmarkPlayer, uint32_t depth, uint32_t iterations, int64_t& allocatedBytes)
+    {
+        AZ::IAllocator& systemAllocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        AZStd::chrono::steady_clock::duration replayTime{};
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            benchmarkPlayer.m_movementInput->m_forwardAxis = StickAxis((iteration % 2 == 0) ? 1.0f : -1.0f);
+            benchmarkPlayer.m_movementInput->m_resetCount = benchmarkPlayer.m_transformController->GetResetCount();
+
+            const size_t allocatedBefore = systemAllocator.NumAllocatedBytes();
+            const auto replayStart = AZStd::chrono::steady_clock::now();
+            for (uint32_t replayedInput = 0; replayedInput < depth; ++replayedInput)
+            {
+                benchmarkPlayer.m_input.SetClientInputId(++benchmarkPlayer.m_clientInputId);
+                benchmarkPlayer.m_netBindComponent->ProcessInput(benchmarkPlayer.m_input, benchmarkPlayer.m_deltaTime);
+            }
+            replayTime += AZStd::chrono::steady_clock::now() - replayStart;
+            allocatedBytes += static_cast<int64_t>(systemAllocator.NumAllocatedBytes()) - static_cast<int64_t>(allocatedBefore);
+        }
+        return replayTime;
+    }
+
+    static double ToMicroseconds(AZStd::chrono::steady_clock::duration duration)
+    {
+        return static_cast<double>(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(duration).count()) / 1000.0;
+    }
+
+    //! Replays runs of inputs through a spawned player and reports how the cost grows with the replay depth.
+    static void RunMovementReplayBenchmark(uint32_t maxDepth, uint32_t iterations)
+    {
+        MovementBenchmarkPlayer benchmarkPlayer;
+        if (!SpawnMovementBenchmarkPlayer(benchmarkPlayer, "BenchmarkMovementReplay"))
+        {
+            return;
+        }
+
+        for (uint32_t depth = 1; depth <= maxDepth; depth *= 2)
+        {
+            int64_t allocatedBytes = 0;
+            const double replayUs = ToMicroseconds(ReplayMovementInputs(benchmarkPlayer, depth, iterations, allocatedBytes));
+            const double inputCount = AZStd::max(static_cast<double>(depth) * iterations, 1.0);
+            AZLOG_INFO("Movement replay benchmark, depth %u over %u replays: %.3f us per replay, %.3f us per input, %.0f inputs per second, "
+                "%.1f bytes allocated per input",
+                depth, iterations, replayUs / AZStd::max(static_cast<double>(iterations), 1.0), replayUs / inputCount,
+                (replayUs > 0.0) ? inputCount * 1000000.0 / replayUs : 0.0, static_cast<double>(allocatedBytes) / inputCount);
+        }
+
+        Multiplayer::GetNetworkEntityManager()->MarkForRemoval(benchmarkPlayer.m_player);
+    }
+
+    static void BenchmarkMovementReplay(const AZ::ConsoleCommandContainer& arguments)
+    {
+        uint32_t maxDepth = 32;
+        uint32_t iterations = 100;
+        if (arguments.size() > 0)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(maxDepth, arguments[0]);
+        }
+        if (arguments.size() > 1)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(iterations, arguments[1]);
+        }
+        RunMovementReplayBenchmark(maxDepth, iterations);
+    }
+    AZ_CONSOLEFREEFUNC(BenchmarkMovementReplay, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Benchmarks replaying movement inputs on a spawned player at doubling depths, takes a max depth and replays per depth (defaults to 32 and 100)");
+
+    //! Replays the same inputs with the character controller queried through the EBus and through the cached handler,
+    //! and reports the replay throughput of each in inputs per millisecond.
+    static void RunMovementCharacterQueryBenchmark(uint32_t depth, uint32_t iterations)
+    {
+        MovementBenchmarkPlayer benchmarkPlayer;
+        if (!SpawnMovementBenchmarkPlayer(benchmarkPlayer, "BenchmarkMovementCharacterQueries"))
+        {
+            return;
+        }
+
+        const bool cachedCharacterQueries = mps_movementCachedCharacterQueries;
+        const double inputCount = AZStd::max(static_cast<double>(depth) * iterations, 1.0);
+        double inputsPerMs[2] = {};
+        for (const bool cached : { false, true })
+        {
+            mps_movementCachedCharacterQueries = cached;
+            int64_t allocatedBytes = 0;
+            const double replayUs = ToMicroseconds(ReplayMovementInputs(benchmarkPlayer, depth, iterations, allocatedBytes));
+            inputsPerMs[cached ? 1 : 0] = (replayUs > 0.0) ? inputCount * 1000.0 / replayUs : 0.0;
+        }
+        mps_movementCachedCharacterQueries = cachedCharacterQueries;
+
+        AZLOG_INFO("Movement character query benchmark, depth %u over %u replays: %.1f inputs per ms through the EBus, "
+            "%.1f inputs per ms through the cached handler (%.2fx)",
+            depth, iterations, inputsPerMs[0], inputsPerMs[1], (inputsPerMs[0] > 0.0) ? inputsPerMs[1] / inputsPerMs[0] : 0.0);
+
+        Multiplayer::GetNetworkEntityManager()->MarkForRemoval(benchmarkPlayer.m_player);
+    }
+
+    static void BenchmarkMovementCharacterQueries(const AZ::ConsoleCommandContainer& arguments)
+    {
+        uint32_t depth = 16;
+        uint32_t iterations = 1000;
+        if (arguments.size() > 0)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(depth, arguments[0]);
+        }
+        if (arguments.size() > 1)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(iterations, arguments[1]);
+        }
+        RunMovementCharacterQueryBenchmark(depth, iterations);
+    }
+    AZ_CONSOLEFREEFUNC(BenchmarkMovementCharacterQueries, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Compares movement replay throughput with and without the cached character controller handler, takes a replay depth and replay count (defaults to 16 and 1000)");
+
     void NetworkPlayerMovementComponentController::HandleApplyImpulse([[maybe_unused]] AzNetworking::IConnection* connection, const AZ::Vector3& impulse, const bool& external)
     {
         if (external)
@@ -511,6 +766,19 @@ namespace MultiplayerSample
         return fwd;
     }
 
+    bool NetworkPlayerMovementComponentController::IsCharacterOnGround() const
+    {
+        if (m_characterGameplayRequests != nullptr && mps_movementCachedCharacterQueries)
+        {
+            return m_characterGameplayRequests->IsOnGround();
+        }
+
+        // The character controller hasn't been activated yet, fall back to the bus so we keep the last replicated state
+        bool onGround = GetOnGround();
+        PhysX::CharacterGameplayRequestBus::EventResult(onGround, GetEntityId(), &PhysX::CharacterGameplayRequestBus::Events::IsOnGround);
+        return onGround;
+    }
+
     float NetworkPlayerMovementComponentController::NormalizeHeading(float heading) const
     {
         // Ensure heading in range [-pi, +pi]
@@ -628,17 +896,6 @@ namespace MultiplayerSample
         }
     }
 
-#if AZ_TRAIT_SERVER
-    void NetworkPlayerMovementComponentController::UpdateAI()
-    {
-        float deltaTime = static_cast<float>(m_updateAI.TimeInQueueMs()) / 1000.f;
-        if (m_networkAiComponentController != nullptr)
-        {
-            m_networkAiComponentController->TickMovement(*this, deltaTime);
-        }
-    }
-#endif
-
 #if AZ_TRAIT_CLIENT
     void NetworkPlayerMovementComponentController::UpdateLocalBot()
     {
@@ -9,8 +9,10 @@
 
 #include <Source/AutoGen/NetworkPlayerMovementComponent.AutoComponent.h>
 #include <Source/Components/NetworkAiComponent.h>
+#include <Source/PeriodicStats.h>
 #include <StartingPointInput/InputEventNotificationBus.h>
 #include <AzFramework/Physics/CharacterBus.h>
+#include <PhysX/CharacterGameplayBus.h>
 
 namespace MultiplayerSample
 {
@@ -58,11 +60,17 @@ namespace MultiplayerSample
     private:
         friend class NetworkAiComponentController;
 
+        void ProcessMovementInput(NetworkPlayerMovementComponentNetworkInput& playerInput, Multiplayer::NetworkInput& input, float deltaTime);
+        void UpdateInputStats(AZ::TimeUs processTime);
         void UpdateVelocity(const NetworkPlayerMovementComponentNetworkInput& playerInput, float deltaTime, bool& jumpTriggered, bool& movingDownward);
         float NormalizeHeading(float heading) const;
 
         AZ::Vector3 GetSlopeHeading(float targetHeading) const;
 
+        //! Queries the character controller for its grounded state.
+        //! Uses the cached gameplay handler so that input replays don't pay for an EBus dispatch per query.
+        bool IsCharacterOnGround() const;
+
         //! AZ::InputEventNotificationBus interface
         //! @{
         void OnPressed(float value) override;
@@ -71,8 +79,6 @@ namespace MultiplayerSample
         //! @}
 
 #if AZ_TRAIT_SERVER
-        void UpdateAI();
-        AZ::ScheduledEvent m_updateAI;
         NetworkAiComponentController* m_networkAiComponentController = nullptr;
 #endif
 
@@ -115,5 +121,22 @@ namespace MultiplayerSample
         float m_gravityMultiplier = 1.0f;
         float m_stepHeight = 0.1f;
         float m_radius = 0.3f;
+
+        //! Live input processing cost, logged when mps_movementInputStats is enabled.
+        //! Any input processed beyond the first one between two CreateInput() calls is a replay caused by a correction.
+        //! This only samples the inputs a running session happens to process, BenchmarkMovementReplay sweeps replay depths on demand.
+        struct InputStats
+        {
+            uint32_t m_processedInputs = 0;
+            uint32_t m_replayedInputs = 0;
+            uint32_t m_maxReplayDepth = 0;
+            uint32_t m_inputsSinceCreate = 0;
+            AZ::TimeUs m_processTime = AZ::Time::ZeroTimeUs;
+        };
+        InputStats m_inputStats;
+        PeriodicStats m_inputStatsReport;
+
+        // Cached on character activation, since ProcessInput queries it several times per input and inputs get replayed on correction
+        PhysX::CharacterGameplayRequests* m_characterGameplayRequests = nullptr;
     };
 }
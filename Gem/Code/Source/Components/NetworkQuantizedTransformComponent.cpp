@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/array.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <Source/Components/NetworkQuantizedTransformComponent.h>
+#include <Source/Components/QuantizedTransformBoundsComponent.h>
+
+namespace MultiplayerSample
+{
+    constexpr float Sqrt2 = 1.41421356f;
+
+    void NetworkQuantizedTransformComponent::Reflect(AZ::ReflectContext* context)
+    {
+        AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serializeContext)
+        {
+            serializeContext->Class<NetworkQuantizedTransformComponent, NetworkQuantizedTransformComponentBase>()
+                ->Version(1);
+        }
+        NetworkQuantizedTransformComponentBase::Reflect(context);
+    }
+
+    void NetworkQuantizedTransformComponent::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
+    {
+        if (IsNetEntityRoleClient())
+        {
+            m_bounds = QuantizedTransformBoundsComponent::GetQuantizationBounds();
+            PositionAddEvent(m_positionChangedHandler);
+            RotationAddEvent(m_rotationChangedHandler);
+            GetNetBindComponent()->AddEntityPreRenderEventHandler(m_preRenderEventHandler);
+
+            // The initial values arrive with the entity, before the handlers are connected, so there is nothing to blend from
+            m_targetPosition = DequantizePosition(GetPosition(), m_bounds);
+            m_targetRotation = DequantizeRotation(GetRotation());
+            m_previousPosition = m_targetPosition;
+            m_previousRotation = m_targetRotation;
+            m_targetHostFrameId = Multiplayer::InvalidHostFrameId;
+
+            AZ::Transform worldTm = GetEntity()->GetTransform()->GetWorldTM();
+            worldTm.SetTranslation(m_targetPosition);
+            worldTm.SetRotation(m_targetRotation);
+            GetEntity()->GetTransform()->SetWorldTM(worldTm);
+        }
+    }
+
+    void NetworkQuantizedTransformComponent::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
+    {
+        m_positionChangedHandler.Disconnect();
+        m_rotationChangedHandler.Disconnect();
+        m_preRenderEventHandler.Disconnect();
+    }
+
+    QuantizedPosition NetworkQuantizedTransformComponent::QuantizePosition(const AZ::Vector3& position, const AZ::Aabb& bounds)
+    {
+        const AZ::Vector3 normalized = (position - bounds.GetMin()) / bounds.GetExtents();
+        return QuantizedPosition(normalized.GetClamp(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne()));
+    }
+
+    AZ::Vector3 NetworkQuantizedTransformComponent::DequantizePosition(const QuantizedPosition& position, const AZ::Aabb& bounds)
+    {
+        return bounds.GetMin() + static_cast<AZ::Vector3>(position) * bounds.GetExtents();
+    }
+
+    QuantizedRotation NetworkQuantizedTransformComponent::QuantizeRotation(const AZ::Quaternion& rotation)
+    {
+        const AZ::Quaternion normalized = rotation.GetNormalized();
+
+        uint8_t largestIndex = 0;
+        for (uint8_t index = 1; index < 4; ++index)
+        {
+            if (AZStd::abs(normalized.GetElement(index)) > AZStd::abs(normalized.GetElement(largestIndex)))
+            {
+                largestIndex = index;
+            }
+        }
+
+        // q and -q are the same rotation, flip it so the dropped component is positive and can be rebuilt without a sign
+        const float sign = (normalized.GetElement(largestIndex) < 0.0f) ? -1.0f : 1.0f;
+
+        float smallestThree[3];
+        for (uint8_t index = 0, outIndex = 0; index < 4; ++index)
+        {
+            if (index != largestIndex)
+            {
+                smallestThree[outIndex++] = sign * normalized.GetElement(index) * Sqrt2;
+            }
+        }
+
+        QuantizedRotation result;
+        result.m_smallestThree = AZ::Vector3(smallestThree[0], smallestThree[1], smallestThree[2]);
+        result.m_largestIndex = largestIndex;
+        return result;
+    }
+
+    AZ::Quaternion NetworkQuantizedTransformComponent::DequantizeRotation(const QuantizedRotation& rotation)
+    {
+        const AZ::Vector3 smallestThree = static_cast<AZ::Vector3>(rotation.m_smallestThree) / Sqrt2;
+        const float largest = AZStd::sqrt(AZStd::max(0.0f, 1.0f - smallestThree.GetLengthSq()));
+
+        float elements[4];
+        for (uint8_t index = 0, inIndex = 0; index < 4; ++index)
+        {
+            elements[index] = (index == rotation.m_largestIndex) ? largest : smallestThree.GetElement(inIndex++);
+        }
+        return AZ::Quaternion(elements[0], elements[1], elements[2], elements[3]).GetNormalized();
+    }
+
+    void NetworkQuantizedTransformComponent::OnPositionChanged(const QuantizedPosition& position)
+    {
+        BeginTargetFrame();
+        m_targetPosition = DequantizePosition(position, m_bounds);
+    }
+
+    void NetworkQuantizedTransformComponent::OnRotationChanged(const QuantizedRotation& rotation)
+    {
+        BeginTargetFrame();
+        m_targetRotation = DequantizeRotation(rotation);
+    }
+
+    void NetworkQuantizedTransformComponent::BeginTargetFrame()
+    {
+        const Multiplayer::HostFrameId hostFrameId = Multiplayer::GetNetworkTime()->GetHostFrameId();
+        if (hostFrameId != m_targetHostFrameId)
+        {
+            // Position and rotation change independently, whichever didn't change this frame blends from its target to itself
+            m_previousPosition = m_targetPosition;
+            m_previousRotation = m_targetRotation;
+            m_targetHostFrameId = hostFrameId;
+        }
+    }
+
+    void NetworkQuantizedTransformComponent::OnPreRender([[maybe_unused]] float deltaTime)
+    {
+        // Blend only during the frame the update arrived for, once the server has moved on without changing the values we hold the target
+        float blendFactor = 1.0f;
+        if (m_targetHostFrameId == Multiplayer::GetNetworkTime()->GetHostFrameId())
+        {
+            blendFactor = Multiplayer::GetMultiplayer()->GetCurrentBlendFactor();
+        }
+
+        AZ::Transform worldTm = GetEntity()->GetTransform()->GetWorldTM();
+        const AZ::Vector3 position = m_previousPosition.Lerp(m_targetPosition, blendFactor);
+        const AZ::Quaternion rotation = m_previousRotation.Slerp(m_targetRotation, blendFactor).GetNormalized();
+        if (!position.IsClose(worldTm.GetTranslation()) || !rotation.IsClose(worldTm.GetRotation()))
+        {
+            worldTm.SetTranslation(position);
+            worldTm.SetRotation(rotation);
+            GetEntity()->GetTransform()->SetWorldTM(worldTm);
+        }
+    }
+
+    void NetworkQuantizedTransformComponent::RunBenchmark(uint32_t entityCount, uint32_t updatesPerSecond, uint32_t sampleCount)
+    {
+        const AZ::Aabb bounds = QuantizedTransformBoundsComponent::GetQuantizationBounds();
+        AZ::SimpleLcgRandom random(1234);
+
+        AZStd::array<uint8_t, 64> buffer;
+        uint64_t quantizedBytes = 0;
+        uint64_t fullBytes = 0;
+        float maxPositionError = 0.0f;
+        float maxRotationErrorRad = 0.0f;
+        const uint32_t samples = AZStd::max(sampleCount, 1u);
+        for (uint32_t sample = 0; sample < samples; ++sample)
+        {
+            const AZ::Vector3 position = bounds.GetMin() + bounds.GetExtents() *
+                AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat());
+            const AZ::Quaternion rotation = AZ::Quaternion(random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f,
+                random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f).GetNormalized();
+
+            QuantizedPosition quantizedPosition = QuantizePosition(position, bounds);
+            QuantizedRotation quantizedRotation = QuantizeRotation(rotation);
+            AzNetworking::NetworkInputSerializer quantizedSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+            quantizedSerializer.Serialize(quantizedPosition, "Position");
+            quantizedSerializer.Serialize(quantizedRotation, "Rotation");
+            quantizedBytes += quantizedSerializer.GetSize();
+
+            // The properties NetworkTransformComponent replicates for an entity that moves, rotation, translation and scale
+            AZ::Vector3 fullPosition = position;
+            AZ::Quaternion fullRotation = rotation;
+            float fullScale = 1.0f;
+            AzNetworking::NetworkInputSerializer fullSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+            fullSerializer.Serialize(fullRotation, "Rotation");
+            fullSerializer.Serialize(fullPosition, "Translation");
+            fullSerializer.Serialize(fullScale, "Scale");
+            fullBytes += fullSerializer.GetSize();
+
+            maxPositionError = AZStd::max(maxPositionError, position.GetDistance(DequantizePosition(quantizedPosition, bounds)));
+            const float dot = AZStd::min(AZStd::abs(rotation.Dot(DequantizeRotation(quantizedRotation))), 1.0f);
+            maxRotationErrorRad = AZStd::max(maxRotationErrorRad, 2.0f * AZStd::acos(dot));
+        }
+
+        const double quantizedBytesPerUpdate = static_cast<double>(quantizedBytes) / samples;
+        const double fullBytesPerUpdate = static_cast<double>(fullBytes) / samples;
+        const double savedBytesPerSecond = (fullBytesPerUpdate - quantizedBytesPerUpdate) * updatesPerSecond;
+        AZLOG_INFO("Quantized transform benchmark, %u samples: %.1f bytes per entity per second quantized, %.1f at full precision, "
+            "%.1f saved per entity and %.1f KB/s saved for %u entities at %u updates per second. Max error %.4f m, %.4f degrees",
+            samples, quantizedBytesPerUpdate * updatesPerSecond, fullBytesPerUpdate * updatesPerSecond, savedBytesPerSecond,
+            savedBytesPerSecond * entityCount / 1024.0, entityCount, updatesPerSecond, maxPositionError, AZ::RadToDeg(maxRotationErrorRad));
+    }
+
+    static void BenchmarkQuantizedTransform(const AZ::ConsoleCommandContainer& arguments)
+    {
+        uint32_t entityCount = 2000;
+        uint32_t updatesPerSecond = 30;
+        uint32_t sampleCount = 100000;
+        if (arguments.size() > 0)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(entityCount, arguments[0]);
+        }
+        if (arguments.size() > 1)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(updatesPerSecond, arguments[1]);
+        }
+        if (arguments.size() > 2)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(sampleCount, arguments[2]);
+        }
+        NetworkQuantizedTransformComponent::RunBenchmark(entityCount, updatesPerSecond, sampleCount);
+    }
+    AZ_CONSOLEFREEFUNC(BenchmarkQuantizedTransform, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Compares quantized and full precision transform payloads, takes an entity count, updates per second and sample count (defaults to 2000, 30 and 100000)");
+
+    NetworkQuantizedTransformComponentController::NetworkQuantizedTransformComponentController(NetworkQuantizedTransformComponent& parent)
+        : NetworkQuantizedTransformComponentControllerBase(parent)
+    {
+    }
+
+    void NetworkQuantizedTransformComponentController::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
+    {
+        if (IsNetEntityRoleAuthority())
+        {
+            m_bounds = QuantizedTransformBoundsComponent::GetQuantizationBounds();
+            OnTransformChanged(GetEntity()->GetTransform()->GetWorldTM());
+            GetEntity()->GetTransform()->BindTransformChangedEventHandler(m_transformChangedHandler);
+        }
+    }
+
+    void NetworkQuantizedTransformComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
+    {
+        m_transformChangedHandler.Disconnect();
+    }
+
+    void NetworkQuantizedTransformComponentController::OnTransformChanged(const AZ::Transform& worldTm)
+    {
+        // Only values that differ after quantization mark the properties dirty, so sub-precision jitter costs nothing
+        const QuantizedPosition position = NetworkQuantizedTransformComponent::QuantizePosition(worldTm.GetTranslation(), m_bounds);
+        if (position != GetPosition())
+        {
+            SetPosition(position);
+        }
+
+        const QuantizedRotation rotation = NetworkQuantizedTransformComponent::QuantizeRotation(worldTm.GetRotation());
+        if (rotation != GetRotation())
+        {
+            SetRotation(rotation);
+        }
+    }
+}
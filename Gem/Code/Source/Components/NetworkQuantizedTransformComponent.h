@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Aabb.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Source/AutoGen/NetworkQuantizedTransformComponent.AutoComponent.h>
+
+namespace MultiplayerSample
+{
+    //! @brief Replicates an entity's world position and rotation in 13 bytes, instead of a full precision transform.
+    //! Add it to a prefab in place of Multiplayer::NetworkTransformComponent for objects that don't need more than
+    //! centimeter precision. Positions are quantized against the level's QuantizedTransformBoundsComponent.
+    //! Clients blend from the previous to the latest update over the server frame, the same way NetworkTransformComponent does.
+    //! The transform isn't rewound, so don't use it on entities that lag compensated hits are traced against, and scale isn't replicated.
+    class NetworkQuantizedTransformComponent
+        : public NetworkQuantizedTransformComponentBase
+    {
+    public:
+        AZ_MULTIPLAYER_COMPONENT(MultiplayerSample::NetworkQuantizedTransformComponent, s_networkQuantizedTransformComponentConcreteUuid, MultiplayerSample::NetworkQuantizedTransformComponentBase);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        void OnActivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
+        void OnDeactivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
+
+        static QuantizedPosition QuantizePosition(const AZ::Vector3& position, const AZ::Aabb& bounds);
+        static AZ::Vector3 DequantizePosition(const QuantizedPosition& position, const AZ::Aabb& bounds);
+        static QuantizedRotation QuantizeRotation(const AZ::Quaternion& rotation);
+        static AZ::Quaternion DequantizeRotation(const QuantizedRotation& rotation);
+
+        //! Serializes random transforms both quantized and at full precision, and logs the bytes per entity per second
+        //! at the given update rate along with the worst quantization error.
+        static void RunBenchmark(uint32_t entityCount, uint32_t updatesPerSecond, uint32_t sampleCount);
+
+    private:
+        void OnPositionChanged(const QuantizedPosition& position);
+        void OnRotationChanged(const QuantizedRotation& rotation);
+        void OnPreRender(float deltaTime);
+
+        //! Moves the current target to the previous values the first time an update arrives for a new server frame.
+        void BeginTargetFrame();
+
+        AZ::Event<QuantizedPosition>::Handler m_positionChangedHandler{ [this](const QuantizedPosition& position)
+        {
+            OnPositionChanged(position);
+        } };
+
+        AZ::Event<QuantizedRotation>::Handler m_rotationChangedHandler{ [this](const QuantizedRotation& rotation)
+        {
+            OnRotationChanged(rotation);
+        } };
+
+        Multiplayer::EntityPreRenderEvent::Handler m_preRenderEventHandler{ [this](float deltaTime)
+        {
+            OnPreRender(deltaTime);
+        } };
+
+        AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+        AZ::Vector3 m_previousPosition = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_targetPosition = AZ::Vector3::CreateZero();
+        AZ::Quaternion m_previousRotation = AZ::Quaternion::CreateIdentity();
+        AZ::Quaternion m_targetRotation = AZ::Quaternion::CreateIdentity();
+        Multiplayer::HostFrameId m_targetHostFrameId = Multiplayer::InvalidHostFrameId;
+    };
+
+    class NetworkQuantizedTransformComponentController
+        : public NetworkQuantizedTransformComponentControllerBase
+    {
+    public:
+        explicit NetworkQuantizedTransformComponentController(NetworkQuantizedTransformComponent& parent);
+
+        void OnActivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
+        void OnDeactivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
+
+    private:
+        void OnTransformChanged(const AZ::Transform& worldTm);
+
+        AZ::TransformChangedEvent::Handler m_transformChangedHandler{ [this]([[maybe_unused]] const AZ::Transform& localTm, const AZ::Transform& worldTm)
+        {
+            OnTransformChanged(worldTm);
+        } };
+
+        AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+    };
+}
@@ -7,27 +7,43 @@
 
 #include <AzCore/Math/Random.h>
 #include <Source/Components/NetworkRandomComponent.h>
+#include <Source/Replay/ServerInputRecorder.h>
+#include <Source/Replay/ServerInputReplayer.h>
 
 namespace MultiplayerSample
 {
     uint64_t NetworkRandomComponentController::GetRandomUint64()
+    {
+        return GetRandomUint64(ModifySeed());
+    }
+
+    int NetworkRandomComponentController::GetRandomInt()
+    {
+        return GetRandomInt(ModifySeed());
+    }
+
+    float NetworkRandomComponentController::GetRandomFloat()
+    {
+        return GetRandomFloat(ModifySeed());
+    }
+
+    uint64_t NetworkRandomComponentController::GetRandomUint64(uint64_t& seed)
     {
         // Reimplements SimpleLcgRandom's rand int with a synchronized seed
-        uint64_t& seed = ModifySeed();
-        seed = (GetSeed() * 0x5DEECE66DLL + 0xBLL) & ((1LL << 48) - 1);
+        seed = (seed * 0x5DEECE66DLL + 0xBLL) & ((1LL << 48) - 1);
         return seed;
     }
 
-    int NetworkRandomComponentController::GetRandomInt()
+    int NetworkRandomComponentController::GetRandomInt(uint64_t& seed)
     {
         // Reimplements SimpleLcgRandom's rand int with a synchronized seed
-        return static_cast<unsigned int>(GetRandomUint64() >> 16);
+        return static_cast<unsigned int>(GetRandomUint64(seed) >> 16);
     }
 
-    float NetworkRandomComponentController::GetRandomFloat()
+    float NetworkRandomComponentController::GetRandomFloat(uint64_t& seed)
     {
         // Reimplements SimpleLcgRandom's rand float with a synchronized seed
-        unsigned int r = GetRandomInt();
+        unsigned int r = GetRandomInt(seed);
             r &= 0x007fffff; //sets mantissa to random bits
             r |= 0x3f800000; //result is in [1,2), uniformly distributed
             union
@@ -56,7 +72,23 @@ namespace MultiplayerSample
 
     void NetworkRandomComponentController::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
-        ;
+#if AZ_TRAIT_SERVER
+        if (IsNetEntityRoleAuthority())
+        {
+            // While replaying, level entities start from the seeds they had when the session was recorded
+            uint64_t recordedSeed = 0;
+            ServerInputReplayer* replayer = AZ::Interface<ServerInputReplayer>::Get();
+            if (replayer && replayer->FindLevelEntitySeed(GetNetEntityId(), recordedSeed))
+            {
+                SetSeed(recordedSeed);
+            }
+
+            if (ServerInputRecorder* recorder = AZ::Interface<ServerInputRecorder>::Get())
+            {
+                recorder->RecordSeed(GetNetEntityId(), GetSeed());
+            }
+        }
+#endif
     }
 
     void NetworkRandomComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
@@ -25,5 +25,14 @@ namespace MultiplayerSample
 
         //! Returns a float in the range of [0,1)
         float GetRandomFloat();
+
+        //! Stateless versions of the above that advance a copy of the seed.
+        //! These produce the same sequence as the member versions, so callers can compute random values off the main thread
+        //! and write the seed back afterwards.
+        //! @{
+        static uint64_t GetRandomUint64(uint64_t& seed);
+        static int GetRandomInt(uint64_t& seed);
+        static float GetRandomFloat(uint64_t& seed);
+        //! @}
     };
 }
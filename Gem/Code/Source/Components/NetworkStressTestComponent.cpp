@@ -11,15 +11,32 @@
 #include <Source/Components/NetworkAiComponent.h>
 #include <Source/Components/NetworkPlayerMovementComponent.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Time/ITime.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzNetworking/Framework/INetworking.h>
+#include <AzNetworking/Framework/INetworkInterface.h>
 #include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/MultiplayerConstants.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/ConnectionData/IConnectionData.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
 
 namespace MultiplayerSample
 {
+#if AZ_TRAIT_SERVER
+    AZ_CVAR(uint32_t, sv_swarmTargetBots, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If > 0, the stress test component ramps AI bots up to this count and records server metrics. Can be set on the command line for headless servers.");
+    AZ_CVAR(uint32_t, sv_swarmSpawnsPerSecond, 5, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of AI bots swarm mode spawns each second while ramping up");
+    AZ_CVAR(uint32_t, sv_swarmHoldSeconds, 60, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of seconds swarm mode holds at the target bot count before finishing");
+    AZ_CVAR(bool, sv_swarmQuitOnComplete, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, the server quits once swarm mode finishes holding at the target bot count");
+    AZ_CVAR(AZ::CVarFixedString, sv_swarmMetricsFile, "@user@/swarm_metrics.csv", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The CSV file swarm mode writes its per-second metrics to");
+#endif
+
     void NetworkStressTestComponent::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
@@ -40,6 +57,20 @@ namespace MultiplayerSample
         : NetworkStressTestComponentControllerBase(owner)
 #if AZ_TRAIT_SERVER
         , m_autoSpawnTimer([this]() { HandleSpawnAiEntity(); }, AZ::Name("StressTestSpawner Event"))
+        , m_swarmTimer([this]() { UpdateSwarm(); }, AZ::Name("StressTestSwarm Event"))
+        , m_swarmFrameTimer([this]()
+            {
+                // The event's own queue time is in whole milliseconds, which is too coarse for server frames
+                const AZ::TimeUs currentTime = AZ::GetElapsedTimeUs();
+                if (m_swarmLastFrameTime != AZ::Time::ZeroTimeUs)
+                {
+                    const AZ::TimeUs frameTime = currentTime - m_swarmLastFrameTime;
+                    ++m_swarmFrameCount;
+                    m_swarmFrameTime += frameTime;
+                    m_swarmMaxFrameTime = AZStd::max(m_swarmMaxFrameTime, frameTime);
+                }
+                m_swarmLastFrameTime = currentTime;
+            }, AZ::Name("StressTestSwarmFrame Event"))
 #endif
     {
         ;
@@ -68,6 +99,11 @@ namespace MultiplayerSample
         {
             m_autoSpawnTimer.Enqueue(GetAutoSpawnIntervalMs(), true);
         }
+
+        if (sv_swarmTargetBots > 0 && IsNetEntityRoleAuthority())
+        {
+            StartSwarm();
+        }
 #endif
     }
 
@@ -76,6 +112,10 @@ namespace MultiplayerSample
 #ifdef IMGUI_ENABLED
         ImGui::ImGuiUpdateListenerBus::Handler::BusDisconnect();
 #endif
+
+#if AZ_TRAIT_SERVER
+        StopSwarm();
+#endif
     }
 
 #if AZ_TRAIT_SERVER
@@ -83,6 +123,120 @@ namespace MultiplayerSample
     {
         HandleSpawnAIEntity(nullptr, m_fireIntervalMinMs, m_fireIntervalMaxMs, m_actionIntervalMinMs, m_actionIntervalMaxMs, m_teamID);
     }
+
+    void NetworkStressTestComponentController::StartSwarm()
+    {
+        AZ::IO::FixedMaxPath metricsPath;
+        const AZ::CVarFixedString metricsFile = sv_swarmMetricsFile;
+        if (!AZ::IO::FileIOBase::GetInstance() || !AZ::IO::FileIOBase::GetInstance()->ResolvePath(metricsPath, metricsFile.c_str()))
+        {
+            metricsPath = metricsFile.c_str();
+        }
+
+        constexpr AZ::IO::OpenMode openMode = AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath;
+        if (!m_swarmMetricsStream.Open(metricsPath.c_str(), openMode))
+        {
+            AZLOG_WARN("Swarm mode failed to open metrics file %s, metrics will not be recorded", metricsPath.c_str());
+        }
+        else
+        {
+            constexpr AZStd::string_view header = "seconds,bots,entities,connections,avgFrameMs,maxFrameMs,bytesSentPerConnection,allocatedBytes\n";
+            m_swarmMetricsStream.Write(header.size(), header.data());
+        }
+
+        m_swarmSeconds = 0;
+        m_swarmHoldSeconds = 0;
+        m_swarmSpawnedBots = 0;
+        m_swarmTargetBots = sv_swarmTargetBots;
+        m_swarmLastSentBytes = 0;
+        m_swarmLastFrameTime = AZ::Time::ZeroTimeUs;
+        m_swarmTimer.Enqueue(AZ::TimeMs{ 1000 }, true);
+        m_swarmFrameTimer.Enqueue(AZ::TimeMs{ 0 }, true);
+
+        AZLOG_INFO("Swarm mode started, ramping to %u bots at %u per second", m_swarmTargetBots,
+            static_cast<uint32_t>(sv_swarmSpawnsPerSecond));
+    }
+
+    void NetworkStressTestComponentController::StopSwarm()
+    {
+        m_swarmTimer.RemoveFromQueue();
+        m_swarmFrameTimer.RemoveFromQueue();
+        if (m_swarmMetricsStream.IsOpen())
+        {
+            m_swarmMetricsStream.Close();
+        }
+    }
+
+    void NetworkStressTestComponentController::UpdateSwarm()
+    {
+        ++m_swarmSeconds;
+        WriteSwarmMetrics();
+
+        if (m_swarmSpawnedBots < m_swarmTargetBots)
+        {
+            const uint32_t spawnCount = AZStd::min<uint32_t>(sv_swarmSpawnsPerSecond, m_swarmTargetBots - m_swarmSpawnedBots);
+            const uint32_t previousSpawnCount = GetSpawnCount();
+            for (uint32_t i = 0; i < spawnCount; ++i)
+            {
+                HandleSpawnAiEntity();
+            }
+
+            const uint32_t spawned = GetSpawnCount() - previousSpawnCount;
+            m_swarmSpawnedBots += spawned;
+            if (spawned < spawnCount)
+            {
+                // MaxSpawns capped us, hold at what we have rather than ramping forever
+                AZLOG_WARN("Swarm mode was capped at %u bots by MaxSpawns", m_swarmSpawnedBots);
+                m_swarmTargetBots = m_swarmSpawnedBots;
+            }
+        }
+        else if (++m_swarmHoldSeconds >= sv_swarmHoldSeconds)
+        {
+            AZLOG_INFO("Swarm mode finished after holding %u bots for %u seconds", m_swarmSpawnedBots, m_swarmHoldSeconds);
+            StopSwarm();
+
+            if (sv_swarmQuitOnComplete)
+            {
+                AZ::Interface<AZ::IConsole>::Get()->PerformCommand("quit");
+            }
+        }
+    }
+
+    void NetworkStressTestComponentController::WriteSwarmMetrics()
+    {
+        Multiplayer::IMultiplayer* multiplayer = AZ::Interface<Multiplayer::IMultiplayer>::Get();
+        const uint32_t entityCount = multiplayer->GetNetworkEntityManager()->GetEntityCount();
+
+        uint32_t connectionCount = 0;
+        uint64_t sentBytes = 0;
+        if (AzNetworking::INetworkInterface* networkInterface =
+            AZ::Interface<AzNetworking::INetworking>::Get()->RetrieveNetworkInterface(AZ::Name(Multiplayer::MpNetworkInterfaceName)))
+        {
+            connectionCount = networkInterface->GetConnectionSet().GetConnectionCount();
+            sentBytes = networkInterface->GetMetrics().m_sendBytes;
+        }
+        const uint64_t sentBytesThisSecond = sentBytes - m_swarmLastSentBytes;
+        m_swarmLastSentBytes = sentBytes;
+
+        const double avgFrameMs = (m_swarmFrameCount > 0)
+            ? static_cast<double>(m_swarmFrameTime) / 1000.0 / m_swarmFrameCount
+            : 0.0;
+        const size_t allocatedBytes = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+
+        if (m_swarmMetricsStream.IsOpen())
+        {
+            const AZStd::string row = AZStd::string::format("%u,%u,%u,%u,%.3f,%.3f,%llu,%zu\n",
+                m_swarmSeconds, m_swarmSpawnedBots, entityCount, connectionCount, avgFrameMs,
+                static_cast<double>(m_swarmMaxFrameTime) / 1000.0,
+                static_cast<unsigned long long>(sentBytesThisSecond / AZStd::max(connectionCount, 1u)),
+                allocatedBytes);
+            m_swarmMetricsStream.Write(row.size(), row.data());
+        }
+
+        m_swarmFrameCount = 0;
+        m_swarmFrameTime = AZ::Time::ZeroTimeUs;
+        m_swarmMaxFrameTime = AZ::Time::ZeroTimeUs;
+    }
 #endif
 
 #if defined(IMGUI_ENABLED)
@@ -164,7 +318,7 @@ namespace MultiplayerSample
         const float& actionIntervalMaxMs,
         [[maybe_unused]] const int& teamId)
     {
-        if (GetSpawnCount() > GetMaxSpawns())
+        if ((GetMaxSpawns() > 0) && (GetSpawnCount() >= GetMaxSpawns()))
         {
             return;
         }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Source/AutoGen/NetworkStressTestComponent.AutoComponent.h>
+#include <AzCore/IO/SystemFile.h>
 
 #if defined(IMGUI_ENABLED)
 #include <imgui/imgui.h>
@@ -77,6 +78,28 @@ namespace MultiplayerSample
 
 #if AZ_TRAIT_SERVER
         AZ::ScheduledEvent m_autoSpawnTimer;
+
+        //! Swarm mode for headless capacity tests, configured through the sv_swarm* cvars.
+        //! Ramps bots up to a target count, holds there, and writes per-second server metrics to a CSV file.
+        //! @{
+        void StartSwarm();
+        void StopSwarm();
+        void UpdateSwarm();
+        void WriteSwarmMetrics();
+
+        AZ::ScheduledEvent m_swarmTimer;
+        AZ::ScheduledEvent m_swarmFrameTimer;
+        AZ::IO::SystemFileStream m_swarmMetricsStream;
+        uint32_t m_swarmSeconds = 0;
+        uint32_t m_swarmHoldSeconds = 0;
+        uint32_t m_swarmSpawnedBots = 0;
+        uint32_t m_swarmTargetBots = 0;
+        uint32_t m_swarmFrameCount = 0;
+        AZ::TimeUs m_swarmLastFrameTime = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_swarmFrameTime = AZ::Time::ZeroTimeUs;
+        AZ::TimeUs m_swarmMaxFrameTime = AZ::Time::ZeroTimeUs;
+        uint64_t m_swarmLastSentBytes = 0;
+        //! @}
 #endif
     };
 } // namespace MultiplayerSample
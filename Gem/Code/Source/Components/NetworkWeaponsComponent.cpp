@@ -10,13 +10,18 @@
 #include <Source/Components/NetworkAiComponent.h>
 #include <Source/Components/NetworkAnimationComponent.h>
 #include <Source/Components/NetworkHealthComponent.h>
-#include <Multiplayer/Components/NetworkRigidBodyComponent.h>
 #include <Source/Components/NetworkMatchComponent.h>
 #include <Source/Components/NetworkSimplePlayerCameraComponent.h>
 #include <Source/Components/Multiplayer/PlayerIdentityComponent.h>
 #include <Source/Weapons/BaseWeapon.h>
+#include <Source/Weapons/WeaponCatchUpBudget.h>
+#include <Source/Weapons/WeaponHitAggregator.h>
+#include <Source/Weapons/WeaponProfiler.h>
+#include <Source/GameplayTrace.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Math/Plane.h>
+#include <AzCore/Time/ITime.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 #include <WeaponNotificationBus.h>
@@ -129,6 +134,8 @@ namespace MultiplayerSample
     void NetworkWeaponsComponent::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
         m_tickSimulatedWeapons.RemoveFromQueue();
+
+        m_activationCountHandler.Disconnect();
     }
 
 #if AZ_TRAIT_CLIENT
@@ -151,6 +158,7 @@ namespace MultiplayerSample
         ActivateEvent activateEvent{ transform, fireParams.m_targetPosition, GetNetEntityId(), Multiplayer::InvalidNetEntityId };
 
         IWeapon* weapon = GetWeapon(weaponIndex);
+        WeaponProfileScope profileScope(weapon->GetParams().m_weaponType, WeaponProfileStage::Activate);
         weapon->Activate(weaponState, GetEntityHandle(), activateEvent, validateActivations);
     }
 
@@ -183,6 +191,13 @@ namespace MultiplayerSample
         }
 
         m_onWeaponActivateEvent.Signal(activationInfo);
+
+        // Catch-up activations past the per frame effect budget are simulated without any presentation
+        if (!m_playActivationEffects)
+        {
+            return;
+        }
+
         WeaponNotificationBus::Broadcast(&WeaponNotificationBus::Events::OnWeaponActivate, GetEntity()->GetId(), activationInfo.m_activateEvent.m_initialTransform);
 
 #if AZ_TRAIT_CLIENT
@@ -234,6 +249,11 @@ namespace MultiplayerSample
 
         m_onWeaponPredictHitEvent.Signal(hitInfo);
 
+        if (!m_playActivationEffects)
+        {
+            return;
+        }
+
         for (const auto& hitEntity : hitInfo.m_hitEvent.m_hitEntities)
         {
             const AZ::Transform hitTransform = AZ::Transform::CreateLookAt(hitEntity.m_hitPosition, hitEntity.m_hitPosition + hitEntity.m_hitNormal, AZ::Transform::Axis::ZPositive);
@@ -264,50 +284,29 @@ namespace MultiplayerSample
             hitInfo.m_weapon.ExecuteImpactEffect(hitInfo.m_weapon.GetFireParams().m_sourcePosition, hitEntity.m_hitPosition);
 #endif
 
-            AZLOG
-            (
-                NET_Weapons,
-                "Predicted hit on entity %" PRIu64 " at position %f x %f x %f",
-                hitEntity.m_hitNetEntityId,
-                hitEntity.m_hitPosition.GetX(),
-                hitEntity.m_hitPosition.GetY(),
-                hitEntity.m_hitPosition.GetZ()
-            );
+            MPS_TRACE(Detail, WeaponPredictedHit, GetNetEntityId(), hitEntity.m_hitNetEntityId,
+                hitEntity.m_hitPosition.GetX(), hitEntity.m_hitPosition.GetY(), hitEntity.m_hitPosition.GetZ());
         }
     }
 
     void NetworkWeaponsComponent::OnWeaponConfirmHit(const WeaponHitInfo& hitInfo)
     {
+        WeaponProfileScope profileScope(hitInfo.m_weapon.GetParams().m_weaponType, WeaponProfileStage::ConfirmHit);
+
 #if AZ_TRAIT_SERVER
         if (IsNetEntityRoleAuthority())
         {
+            WeaponHitAggregator* hitAggregator = AZ::Interface<WeaponHitAggregator>::Get();
+            AZ_Assert(hitAggregator != nullptr, "WeaponHitAggregator is not registered, confirmed hits will not apply damage");
+
+            // Damage and impulses are summed per hit entity and applied once per tick
             for (const HitEntity& hitEntity : hitInfo.m_hitEvent.m_hitEntities)
             {
-                Multiplayer::ConstNetworkEntityHandle entityHandle = Multiplayer::GetMultiplayer()->GetNetworkEntityManager()->GetEntity(hitEntity.m_hitNetEntityId);
-
-                if (entityHandle != nullptr && entityHandle.GetEntity() != nullptr)
+                const float damage = hitInfo.m_weapon.GetHitDamage(hitEntity.m_hitDistance);
+                const AZ::Vector3 impulse = -hitEntity.m_hitNormal * damage * sv_WeaponsImpulseScalar;
+                if (hitAggregator)
                 {
-                    const WeaponParams& weaponParams = hitInfo.m_weapon.GetParams();
-                    const HitEffect effect = weaponParams.m_damageEffect;
-
-                    // Presently set to 1 until we capture falloff range
-                    float hitDistance = 1.f;
-                    float maxDistance = 1.f;
-                    float damage = effect.m_hitMagnitude * powf((effect.m_hitFalloff * (1.0f - hitDistance / maxDistance)), effect.m_hitExponent);
-
-                    // Look for physics rigid body component and make impact updates
-                    if (Multiplayer::NetworkRigidBodyComponent* rigidBodyComponent = entityHandle.GetEntity()->FindComponent<Multiplayer::NetworkRigidBodyComponent>())
-                    {
-                        const AZ::Vector3 hitLocation = hitEntity.m_hitPosition;
-                        const AZ::Vector3 impulse = -hitEntity.m_hitNormal * damage * sv_WeaponsImpulseScalar;
-                        rigidBodyComponent->SendApplyImpulse(impulse, hitLocation);
-                    }
-
-                    // Look for health component and directly update health based on hit parameters
-                    if (NetworkHealthComponent* healthComponent = entityHandle.GetEntity()->FindComponent<NetworkHealthComponent>())
-                    {
-                        healthComponent->SendHealthDelta(damage * -1.0f);
-                    }
+                    hitAggregator->AddHit(hitEntity.m_hitNetEntityId, damage, impulse, hitEntity.m_hitPosition);
                 }
             }
         }
@@ -353,15 +352,8 @@ namespace MultiplayerSample
             hitInfo.m_weapon.ExecuteDamageEffect(hitInfo.m_weapon.GetFireParams().m_sourcePosition, hitEntity.m_hitPosition);
 #endif
 
-            AZLOG
-            (
-                NET_Weapons,
-                "Confirmed hit on entity %" PRIu64 " at position %f x %f x %f",
-                hitEntity.m_hitNetEntityId,
-                hitEntity.m_hitPosition.GetX(),
-                hitEntity.m_hitPosition.GetY(),
-                hitEntity.m_hitPosition.GetZ()
-            );
+            MPS_TRACE(Detail, WeaponConfirmedHit, GetNetEntityId(), hitEntity.m_hitNetEntityId,
+                hitEntity.m_hitPosition.GetX(), hitEntity.m_hitPosition.GetY(), hitEntity.m_hitPosition.GetZ());
         }
     }
 
@@ -380,16 +372,48 @@ namespace MultiplayerSample
             return;
         }
 
-        AZLOG(NET_Weapons, "Client activation event for weapon index %u", index);
-
         WeaponState& weaponState = m_simulatedWeaponStates[index];
         const FireParams& fireParams = GetActivationParams(index);
         weapon->SetFireParams(fireParams);
 
-        while (weaponState.m_activationCount != value)
+        // Activation counts roll over, so the backlog is the wrapped difference
+        const uint32_t backlog = static_cast<uint8_t>(value - weaponState.m_activationCount);
+        if (backlog == 0)
+        {
+            return;
+        }
+
+        // Every missed activation shares the latest fire params, so after a stall only the ones recent enough to still be seen are replayed.
+        // The older ones are skipped outright, which avoids their gathers and effects entirely.
+        // The budget only exists on clients, and every missed activation is replayed without it
+        WeaponCatchUpBudget* catchUpBudget = AZ::Interface<WeaponCatchUpBudget>::Get();
+        const uint32_t replayCount = catchUpBudget ? catchUpBudget->GetReplayCount(backlog, weapon->GetParams().m_cooldownTimeMs) : backlog;
+        weaponState.m_activationCount += static_cast<uint8_t>(backlog - replayCount);
+        MPS_TRACE(Detail, WeaponSimulatedActivation, GetNetEntityId(), index, backlog, replayCount);
+
+        uint32_t silencedCount = 0;
+        for (uint32_t replayIndex = 0; replayIndex < replayCount; ++replayIndex)
         {
+            const AZ::TimeUs replayStartUs = AZ::GetElapsedTimeUs();
+            m_playActivationEffects = catchUpBudget ? catchUpBudget->CanPlayEffects() : true;
+            silencedCount += m_playActivationEffects ? 0 : 1;
+
             constexpr bool validateActivations = false;
             ActivateWeaponWithParams(aznumeric_cast<WeaponIndex>(index), weaponState, fireParams, validateActivations);
+
+            if (catchUpBudget)
+            {
+                catchUpBudget->AddReplayTime(AZ::GetElapsedTimeUs() - replayStartUs);
+            }
+        }
+        m_playActivationEffects = true;
+
+        // Not every weapon type advances its activation count, so land on the authority's count rather than spinning on it
+        weaponState.m_activationCount = value;
+
+        if (catchUpBudget)
+        {
+            catchUpBudget->RecordUpdate(backlog, replayCount, silencedCount);
         }
     }
 
@@ -406,7 +430,6 @@ namespace MultiplayerSample
 
     NetworkWeaponsComponentController::NetworkWeaponsComponentController(NetworkWeaponsComponent& parent)
         : NetworkWeaponsComponentControllerBase(parent)
-        , m_updateAI{[this] { UpdateAI(); }, AZ::Name{ "WeaponsControllerAI" } }
     {
         ;
     }
@@ -417,8 +440,11 @@ namespace MultiplayerSample
         m_aiEnabled = (networkAiComponent != nullptr) ? networkAiComponent->GetEnabled() : false;
         if (m_aiEnabled)
         {
-            m_updateAI.Enqueue(AZ::TimeMs{ 0 }, true);
+#if AZ_TRAIT_SERVER
+            // The NetworkAiSystem drives our inputs from here on
             m_networkAiComponentController = GetNetworkAiComponentController();
+            m_networkAiComponentController->SetWeaponsController(this);
+#endif
         }
         else if (IsNetEntityRoleAutonomous())
         {
@@ -430,6 +456,14 @@ namespace MultiplayerSample
 
     void NetworkWeaponsComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+#if AZ_TRAIT_SERVER
+        if (m_networkAiComponentController != nullptr)
+        {
+            m_networkAiComponentController->SetWeaponsController(nullptr);
+            m_networkAiComponentController = nullptr;
+        }
+#endif
+
         if (IsNetEntityRoleAutonomous() && !m_aiEnabled)
         {
             StartingPointInput::InputEventNotificationBus::MultiHandler::BusDisconnect(DrawEventId);
@@ -599,7 +633,7 @@ namespace MultiplayerSample
             WeaponState& weaponState = ModifyWeaponStates(weaponIndexInt);
             if ((weaponState.m_status == WeaponStatus::Firing) && (weaponState.m_cooldownTime <= 0.0f))
             {
-                AZLOG(NET_Weapons, "Weapon predicted activation event for weapon index %u", weaponIndexInt);
+                MPS_TRACE(Detail, WeaponPredictedActivation, GetNetEntityId(), weaponIndexInt);
 
                 const bool validateActivations = true;
                 const FireParams& fireParams = weapon->GetFireParams();
@@ -621,7 +655,7 @@ namespace MultiplayerSample
     bool NetworkWeaponsComponentController::TryStartFire(WeaponIndex weaponIndex, const FireParams& fireParams)
     {
         const uint32_t weaponIndexInt = aznumeric_cast<uint32_t>(weaponIndex);
-        AZLOG(NET_Weapons, "Weapon start fire on %u", weaponIndexInt);
+        MPS_TRACE(Detail, WeaponStartFire, GetNetEntityId(), weaponIndexInt);
 
         IWeapon* weapon = GetParent().GetWeapon(weaponIndex);
         if (weapon == nullptr)
@@ -691,15 +725,4 @@ namespace MultiplayerSample
     {
         ;
     }
-
-    void NetworkWeaponsComponentController::UpdateAI()
-    {
-#if AZ_TRAIT_SERVER
-        float deltaTime = static_cast<float>(m_updateAI.TimeInQueueMs()) / 1000.f;
-        if (m_networkAiComponentController != nullptr)
-        {
-            m_networkAiComponentController->TickWeapons(*this, deltaTime);
-        }
-#endif
-    }
 } // namespace MultiplayerSample
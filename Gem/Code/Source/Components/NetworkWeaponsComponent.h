@@ -78,6 +78,9 @@ namespace MultiplayerSample
 
         DebugDraw::DebugDrawRequests* m_debugDraw = nullptr;
 
+        //! False while replaying a missed activation after the client frame's catch-up time budget has been spent.
+        bool m_playActivationEffects = true;
+
         OnWeaponActivateEvent m_onWeaponActivateEvent;
         OnWeaponPredictHitEvent m_onWeaponPredictHitEvent;
         OnWeaponConfirmHitEvent m_onWeaponConfirmHitEvent;
@@ -104,8 +107,6 @@ namespace MultiplayerSample
     private:
         friend class NetworkAiComponentController;
 
-        void UpdateAI();
-
         //! Update pump for player controlled weapons
         //! @param deltaTime the time in seconds since last tick
         void UpdateWeaponFiring(float deltaTime);
@@ -121,7 +122,6 @@ namespace MultiplayerSample
         void OnHeld(float value) override;
         //! @}
 
-        AZ::ScheduledEvent m_updateAI;
         NetworkAiComponentController* m_networkAiComponentController = nullptr;
 
         // Technically these values should never migrate hosts since they are maintained by the autonomous client
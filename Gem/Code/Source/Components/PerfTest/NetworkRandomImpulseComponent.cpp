@@ -7,6 +7,7 @@
 
 #include <RigidBodyComponent.h>
 #include <Components/PerfTest/NetworkRandomImpulseComponent.h>
+#include <Components/PerfTest/PerfTestSpatialHash.h>
 
 namespace MultiplayerSample
 {
@@ -18,6 +19,15 @@ namespace MultiplayerSample
 
     void NetworkRandomImpulseComponentController::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+#if AZ_TRAIT_SERVER
+        m_spatialHash = AZ::Interface<PerfTestSpatialHash>::Get();
+        if (m_spatialHash)
+        {
+            m_spatialHash->UpdateObject(GetEntityId(), GetEntity()->GetTransform()->GetWorldTranslation());
+            GetEntity()->GetTransform()->BindTransformChangedEventHandler(m_transformChangedHandler);
+        }
+#endif
+
         if (GetParent().GetEnableHopping())
         {
             m_tickEvent.Enqueue(AZ::TimeMs{ 0 }, true);
@@ -27,6 +37,16 @@ namespace MultiplayerSample
 
     void NetworkRandomImpulseComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+        m_tickEvent.RemoveFromQueue();
+
+#if AZ_TRAIT_SERVER
+        if (m_spatialHash)
+        {
+            m_transformChangedHandler.Disconnect();
+            m_spatialHash->RemoveObject(GetEntityId());
+            m_spatialHash = nullptr;
+        }
+#endif
     }
 
     void NetworkRandomImpulseComponentController::TickEvent()
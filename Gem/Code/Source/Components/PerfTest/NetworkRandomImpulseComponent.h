@@ -8,9 +8,12 @@
 #pragma once
 
 #include <Source/AutoGen/NetworkRandomImpulseComponent.AutoComponent.h>
+#include <AzCore/Component/TransformBus.h>
 
 namespace MultiplayerSample
 {
+    class PerfTestSpatialHash;
+
     class NetworkRandomImpulseComponentController
         : public NetworkRandomImpulseComponentControllerBase
     {
@@ -25,5 +28,15 @@ namespace MultiplayerSample
 
         AZ::ScheduledEvent m_tickEvent;
         void TickEvent();
+
+#if AZ_TRAIT_SERVER
+        PerfTestSpatialHash* m_spatialHash = nullptr;
+
+        // Physics moves these objects whether or not they hop, so the spatial hash follows transform changes instead of the tick
+        AZ::TransformChangedEvent::Handler m_transformChangedHandler{ [this]([[maybe_unused]] const AZ::Transform& localTm, const AZ::Transform& worldTm)
+        {
+            m_spatialHash->UpdateObject(GetEntityId(), worldTm.GetTranslation());
+        } };
+#endif
     };
 }
@@ -6,48 +6,110 @@
  */
 
 #include <Components/PerfTest/NetworkRandomTranslateComponent.h>
+#include <Components/PerfTest/NetworkRandomTranslateSystem.h>
+#include <Components/PerfTest/PerfTestSpatialHash.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/time.h>
 
 namespace MultiplayerSample
 {
+    AZ_CVAR(bool, mps_randomTranslateBatched, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, random translate objects are moved in a single batched pass instead of each ticking on their own. Applies to objects activated after changing it");
+
+    void RandomTranslateState::Advance(float deltaTime)
+    {
+        m_travelTime += deltaTime;
+
+        const float t = m_travelTime / m_movementDuration;
+        m_position = m_position.Lerp(m_destination, t);
+
+        if (m_travelTime > m_movementDuration)
+        {
+            m_travelTime = 0.0f;
+            m_destination = CalculateNextDestination();
+        }
+    }
+
+    AZ::Vector3 RandomTranslateState::CalculateNextDestination()
+    {
+        AZ::Vector3 random(0.5f - m_simpleLcgRandom.GetRandomFloat(), 0.5f - m_simpleLcgRandom.GetRandomFloat(), 0.5f - m_simpleLcgRandom.GetRandomFloat());
+        random = m_maxMoveDistance * random.GetNormalizedEstimate();
+        return m_originalPosition+random;
+    }
+
     NetworkRandomTranslateComponentController::NetworkRandomTranslateComponentController(NetworkRandomTranslateComponent& parent)
-        : NetworkRandomTranslateComponentControllerBase(parent), m_simpleLcgRandom(AZStd::GetTimeUTCMilliSecond())
+        : NetworkRandomTranslateComponentControllerBase(parent)
     {
+        m_state.m_simpleLcgRandom.SetSeed(AZStd::GetTimeUTCMilliSecond());
     }
 
     void NetworkRandomTranslateComponentController::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
-        m_originalPosition = GetParent().GetEntity()->GetTransform()->GetWorldTranslation();
-        m_destination = CalculateNextDestination();
-        AZ::TickBus::Handler::BusConnect();
+        m_state.m_originalPosition = GetParent().GetEntity()->GetTransform()->GetWorldTranslation();
+        m_state.m_position = m_state.m_originalPosition;
+        m_state.m_movementDuration = GetParent().GetMovementDuration();
+        m_state.m_maxMoveDistance = GetParent().GetMaxMoveDistance();
+        m_state.m_travelTime = 0.0f;
+        m_state.m_destination = m_state.CalculateNextDestination();
+
+#if AZ_TRAIT_SERVER
+        m_spatialHash = AZ::Interface<PerfTestSpatialHash>::Get();
+        if (m_spatialHash)
+        {
+            m_spatialHash->UpdateObject(GetEntityId(), m_state.m_originalPosition);
+        }
+#endif
+
+        NetworkRandomTranslateSystem* translateSystem = AZ::Interface<NetworkRandomTranslateSystem>::Get();
+        if (mps_randomTranslateBatched && translateSystem)
+        {
+            translateSystem->RegisterObject(this);
+        }
+        else
+        {
+            AZ::TickBus::Handler::BusConnect();
+        }
     }
 
     void NetworkRandomTranslateComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+        if (m_batched)
+        {
+            if (NetworkRandomTranslateSystem* translateSystem = AZ::Interface<NetworkRandomTranslateSystem>::Get())
+            {
+                translateSystem->UnregisterObject(this);
+            }
+        }
         AZ::TickBus::Handler::BusDisconnect();
+
+#if AZ_TRAIT_SERVER
+        if (m_spatialHash)
+        {
+            m_spatialHash->RemoveObject(GetEntityId());
+            m_spatialHash = nullptr;
+        }
+#endif
+    }
+
+    void NetworkRandomTranslateComponentController::ResumeOwnTick(const RandomTranslateState& state)
+    {
+        m_state = state;
+        m_batched = false;
+        AZ::TickBus::Handler::BusConnect();
     }
 
     void NetworkRandomTranslateComponentController::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
-        m_travelTime += deltaTime;
+        m_state.m_position = GetParent().GetEntity()->GetTransform()->GetWorldTranslation();
+        m_state.Advance(deltaTime);
+        GetParent().GetEntity()->GetTransform()->SetWorldTranslation(m_state.m_position);
 
-        const AZ::Vector3 currentPosition = GetParent().GetEntity()->GetTransform()->GetWorldTranslation();
-        const float t = m_travelTime/GetParent().GetMovementDuration();
-        const AZ::Vector3 newPosition = currentPosition.Lerp(m_destination, t);
-        GetParent().GetEntity()->GetTransform()->SetWorldTranslation(newPosition);
-        
-        if (m_travelTime > GetParent().GetMovementDuration())
+#if AZ_TRAIT_SERVER
+        if (m_spatialHash)
         {
-            m_travelTime = 0.0f;
-            m_destination = CalculateNextDestination();
+            m_spatialHash->UpdateObject(GetEntityId(), m_state.m_position);
         }
-    }
-
-    AZ::Vector3 NetworkRandomTranslateComponentController::CalculateNextDestination()
-    {
-        AZ::Vector3 random(0.5f - m_simpleLcgRandom.GetRandomFloat(), 0.5f - m_simpleLcgRandom.GetRandomFloat(), 0.5f - m_simpleLcgRandom.GetRandomFloat());
-        random = GetParent().GetMaxMoveDistance() * random.GetNormalizedEstimate();
-        return m_originalPosition+random;
+#endif
     }
 }
@@ -14,6 +14,25 @@
 
 namespace MultiplayerSample
 {
+    class PerfTestSpatialHash;
+
+    //! Movement state of a single random translate object.
+    //! Shared by the per-entity tick and the batched update in NetworkRandomTranslateSystem, so both move objects identically.
+    struct RandomTranslateState
+    {
+        AZ::Vector3 m_originalPosition = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_destination = AZ::Vector3::CreateZero();
+        float m_travelTime = 0.0f;
+        float m_movementDuration = 2.0f;
+        float m_maxMoveDistance = 10.0f;
+        AZ::SimpleLcgRandom m_simpleLcgRandom;
+
+        //! Moves m_position towards the destination, picking a new destination once the movement duration has passed.
+        void Advance(float deltaTime);
+        AZ::Vector3 CalculateNextDestination();
+    };
+
     class NetworkRandomTranslateComponentController
         : public NetworkRandomTranslateComponentControllerBase,
           AZ::TickBus::Handler
@@ -28,16 +47,24 @@ namespace MultiplayerSample
         //////////////////////////////////////////////////////////////////////////
 
     private:
+        friend class NetworkRandomTranslateSystem;
+
         //////////////////////////////////////////////////////////////////////////
         // AZ::TickBus::Handler overrides
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
         //////////////////////////////////////////////////////////////////////////
 
-        AZ::Vector3 CalculateNextDestination();
+        //! Called when the NetworkRandomTranslateSystem shuts down, so the object keeps moving from where the batch left it.
+        void ResumeOwnTick(const RandomTranslateState& state);
 
-        AZ::Vector3 m_originalPosition = AZ::Vector3::CreateZero();
-        AZ::Vector3 m_destination = AZ::Vector3::CreateZero();
-        float m_travelTime = 0.0f;
-        AZ::SimpleLcgRandom m_simpleLcgRandom;
+        RandomTranslateState m_state;
+
+        // Set while this object is updated by the NetworkRandomTranslateSystem rather than its own tick
+        bool m_batched = false;
+        size_t m_batchIndex = 0;
+
+#if AZ_TRAIT_SERVER
+        PerfTestSpatialHash* m_spatialHash = nullptr;
+#endif
     };
 }
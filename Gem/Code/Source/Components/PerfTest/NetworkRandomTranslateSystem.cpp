@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Components/PerfTest/NetworkRandomTranslateSystem.h>
+#include <Source/Components/PerfTest/PerfTestSpatialHash.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Time/ITime.h>
+
+namespace MultiplayerSample
+{
+    void NetworkRandomTranslateSystem::Activate()
+    {
+        AZ::Interface<NetworkRandomTranslateSystem>::Register(this);
+    }
+
+    void NetworkRandomTranslateSystem::Deactivate()
+    {
+        m_updateObjectsEvent.RemoveFromQueue();
+        for (size_t index = 0; index < m_controllers.size(); ++index)
+        {
+            m_controllers[index]->ResumeOwnTick(GetState(index));
+        }
+        m_positions.clear();
+        m_destinations.clear();
+        m_travelTimes.clear();
+        m_movementDurations.clear();
+        m_states.clear();
+        m_transforms.clear();
+        m_controllers.clear();
+        AZ::Interface<NetworkRandomTranslateSystem>::Unregister(this);
+    }
+
+    void NetworkRandomTranslateSystem::RegisterObject(NetworkRandomTranslateComponentController* controller)
+    {
+        controller->m_batched = true;
+        controller->m_batchIndex = m_controllers.size();
+
+        const RandomTranslateState& state = controller->m_state;
+        m_positions.push_back(state.m_position);
+        m_destinations.push_back(state.m_destination);
+        m_travelTimes.push_back(state.m_travelTime);
+        m_movementDurations.push_back(state.m_movementDuration);
+        m_states.push_back(state);
+        m_transforms.push_back(controller->GetEntity()->GetTransform());
+        m_controllers.push_back(controller);
+
+        if (!m_updateObjectsEvent.IsScheduled())
+        {
+            m_lastUpdateTime = AZ::GetElapsedTimeUs();
+            m_updateObjectsEvent.Enqueue(AZ::TimeMs{ 0 }, true);
+        }
+    }
+
+    void NetworkRandomTranslateSystem::UnregisterObject(NetworkRandomTranslateComponentController* controller)
+    {
+        const size_t index = controller->m_batchIndex;
+        if (!controller->m_batched || (index >= m_controllers.size()) || (m_controllers[index] != controller))
+        {
+            return;
+        }
+
+        // Order doesn't matter, every object only moves based on its own state
+        const size_t lastIndex = m_controllers.size() - 1;
+        if (index != lastIndex)
+        {
+            m_positions[index] = m_positions[lastIndex];
+            m_destinations[index] = m_destinations[lastIndex];
+            m_travelTimes[index] = m_travelTimes[lastIndex];
+            m_movementDurations[index] = m_movementDurations[lastIndex];
+            m_states[index] = m_states[lastIndex];
+            m_transforms[index] = m_transforms[lastIndex];
+            m_controllers[index] = m_controllers[lastIndex];
+            m_controllers[index]->m_batchIndex = index;
+        }
+        m_positions.pop_back();
+        m_destinations.pop_back();
+        m_travelTimes.pop_back();
+        m_movementDurations.pop_back();
+        m_states.pop_back();
+        m_transforms.pop_back();
+        m_controllers.pop_back();
+
+        controller->m_batched = false;
+
+        if (m_controllers.empty())
+        {
+            m_updateObjectsEvent.RemoveFromQueue();
+        }
+    }
+
+    void NetworkRandomTranslateSystem::UpdateObjects()
+    {
+        // The event's own queue time is in whole milliseconds, which is too coarse for server frames
+        const AZ::TimeUs currentTime = AZ::GetElapsedTimeUs();
+        const float deltaTime = static_cast<float>(currentTime - m_lastUpdateTime) / 1000000.0f;
+        m_lastUpdateTime = currentTime;
+
+        const size_t objectCount = m_states.size();
+
+        // Start from the current translation, other systems may have moved the entity since the last update
+        for (size_t index = 0; index < objectCount; ++index)
+        {
+            m_positions[index] = m_transforms[index]->GetWorldTranslation();
+        }
+
+        // Same math as RandomTranslateState::Advance(), over contiguous arrays with no calls or branches
+        for (size_t index = 0; index < objectCount; ++index)
+        {
+            m_travelTimes[index] += deltaTime;
+            m_positions[index] = m_positions[index].Lerp(m_destinations[index], m_travelTimes[index] / m_movementDurations[index]);
+        }
+
+        for (size_t index = 0; index < objectCount; ++index)
+        {
+            if (m_travelTimes[index] > m_movementDurations[index])
+            {
+                m_travelTimes[index] = 0.0f;
+                m_destinations[index] = m_states[index].CalculateNextDestination();
+            }
+        }
+
+        for (size_t index = 0; index < objectCount; ++index)
+        {
+            m_transforms[index]->SetWorldTranslation(m_positions[index]);
+        }
+
+#if AZ_TRAIT_SERVER
+        if (PerfTestSpatialHash* spatialHash = AZ::Interface<PerfTestSpatialHash>::Get())
+        {
+            for (size_t index = 0; index < objectCount; ++index)
+            {
+                spatialHash->UpdateObject(m_controllers[index]->GetEntityId(), m_positions[index]);
+            }
+        }
+#endif
+    }
+
+    RandomTranslateState NetworkRandomTranslateSystem::GetState(size_t index) const
+    {
+        RandomTranslateState state = m_states[index];
+        state.m_position = m_positions[index];
+        state.m_destination = m_destinations[index];
+        state.m_travelTime = m_travelTimes[index];
+        return state;
+    }
+}
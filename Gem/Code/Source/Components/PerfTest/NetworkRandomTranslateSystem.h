@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/vector.h>
+#include <Source/Components/PerfTest/NetworkRandomTranslateComponent.h>
+
+namespace AZ { class TransformInterface; }
+
+namespace MultiplayerSample
+{
+    //! Moves every batched NetworkRandomTranslateComponent from a single scheduled event, so objects don't each pay for their own TickBus handler.
+    //! The state that changes every update is kept in separate contiguous arrays, and each update runs as separate passes:
+    //! gather every world translation, advance all objects with branch free SIMD vector math, pick new destinations for the few
+    //! objects that arrived, then write every transform back. Like the per-entity path, every update starts from the entity's
+    //! current world translation. Toggle with mps_randomTranslateBatched to compare against the per-entity path.
+    class NetworkRandomTranslateSystem
+    {
+    public:
+        AZ_RTTI(NetworkRandomTranslateSystem, "{A1C26A0E-5F0B-4C3D-8E6B-93D7F24B58C2}");
+
+        NetworkRandomTranslateSystem() = default;
+        virtual ~NetworkRandomTranslateSystem() = default;
+
+        void Activate();
+        //! Hands every registered object back to its own tick.
+        void Deactivate();
+
+        void RegisterObject(NetworkRandomTranslateComponentController* controller);
+        void UnregisterObject(NetworkRandomTranslateComponentController* controller);
+
+    private:
+        void UpdateObjects();
+
+        //! Returns the full movement state of an object, with the per update fields copied back from the batch arrays.
+        RandomTranslateState GetState(size_t index) const;
+
+        // Parallel arrays, indexed by each controller's m_batchIndex.
+        // Positions, destinations and travel times are only kept up to date in their own arrays, m_states holds the rest.
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_destinations;
+        AZStd::vector<float> m_travelTimes;
+        AZStd::vector<float> m_movementDurations;
+        AZStd::vector<RandomTranslateState> m_states;
+        AZStd::vector<AZ::TransformInterface*> m_transforms;
+        AZStd::vector<NetworkRandomTranslateComponentController*> m_controllers;
+
+        AZ::TimeUs m_lastUpdateTime = AZ::Time::ZeroTimeUs;
+
+        AZ::ScheduledEvent m_updateObjectsEvent{ [this]()
+        {
+            UpdateObjects();
+        }, AZ::Name("NetworkRandomTranslateSystemUpdate") };
+    };
+}
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Components/PerfTest/PerfTestSpatialHash.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <MultiplayerSampleTypes.h>
+
+namespace MultiplayerSample
+{
+#if AZ_TRAIT_SERVER
+    AZ_CVAR(bool, sv_perfTestSpatialHashStats, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, periodically logs the perf test spatial hash object count and update cost");
+    AZ_CVAR(AZ::TimeMs, sv_perfTestSpatialHashStatsIntervalMs, AZ::TimeMs{ 5000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "How often the perf test spatial hash stats are logged");
+
+    void PerfTestSpatialHash::Activate()
+    {
+        if (LoadSettings())
+        {
+            AZ::Interface<PerfTestSpatialHash>::Register(this);
+            m_registered = true;
+        }
+    }
+
+    bool PerfTestSpatialHash::LoadSettings()
+    {
+        bool enabled = false;
+        float cellSize = 16.0f;
+        if (const auto registry = AZ::SettingsRegistry::Get())
+        {
+            registry->Get(enabled, PerfTestSpatialHashEnabledSetting);
+
+            double cellSizeSetting = 0.0;
+            if (registry->Get(cellSizeSetting, PerfTestSpatialHashCellSizeSetting) && (cellSizeSetting > 0.0))
+            {
+                cellSize = aznumeric_cast<float>(cellSizeSetting);
+            }
+
+            AZ::s64 relevancyCells = 0;
+            if (registry->Get(relevancyCells, PerfTestSpatialHashRelevancyCellsSetting))
+            {
+                m_relevancyCells = aznumeric_cast<int32_t>(AZStd::max<AZ::s64>(relevancyCells, 0));
+            }
+        }
+        m_inverseCellSize = 1.0f / cellSize;
+        return enabled;
+    }
+
+    void PerfTestSpatialHash::Deactivate()
+    {
+        if (m_registered)
+        {
+            AZ::Interface<PerfTestSpatialHash>::Unregister(this);
+            m_registered = false;
+        }
+        m_objectCells.clear();
+        m_cellObjectCounts.clear();
+        m_updateStats = UpdateStats{};
+        m_statsReport = PeriodicStats{};
+    }
+
+    void PerfTestSpatialHash::UpdateObject(AZ::EntityId entityId, const AZ::Vector3& position)
+    {
+        const AZ::TimeUs startTime = sv_perfTestSpatialHashStats ? AZ::GetElapsedTimeUs() : AZ::Time::ZeroTimeUs;
+
+        const CellKey cellKey = GetCellKey(GetCellCoord(position));
+        auto [objectIter, inserted] = m_objectCells.try_emplace(entityId, cellKey);
+        if (inserted || (objectIter->second != cellKey))
+        {
+            if (!inserted)
+            {
+                ReleaseCell(objectIter->second);
+                objectIter->second = cellKey;
+            }
+            ++m_cellObjectCounts[cellKey];
+            ++m_updateStats.m_cellChanges;
+        }
+
+        if (sv_perfTestSpatialHashStats)
+        {
+            ++m_updateStats.m_updates;
+            m_updateStats.m_updateTime += AZ::GetElapsedTimeUs() - startTime;
+            ReportStats();
+        }
+    }
+
+    void PerfTestSpatialHash::RemoveObject(AZ::EntityId entityId)
+    {
+        const auto objectIter = m_objectCells.find(entityId);
+        if (objectIter != m_objectCells.end())
+        {
+            ReleaseCell(objectIter->second);
+            m_objectCells.erase(objectIter);
+        }
+    }
+
+    bool PerfTestSpatialHash::IsTracked(AZ::EntityId entityId) const
+    {
+        return m_objectCells.contains(entityId);
+    }
+
+    bool PerfTestSpatialHash::IsObjectNear(AZ::EntityId entityId, const AZ::Vector3& position) const
+    {
+        const auto objectIter = m_objectCells.find(entityId);
+        if (objectIter == m_objectCells.end())
+        {
+            return true;
+        }
+
+        const CellCoord objectCell = GetCellCoord(objectIter->second);
+        const CellCoord viewCell = GetCellCoord(position);
+        return (AZStd::abs(objectCell.m_x - viewCell.m_x) <= m_relevancyCells)
+            && (AZStd::abs(objectCell.m_y - viewCell.m_y) <= m_relevancyCells);
+    }
+
+    PerfTestSpatialHash::CellCoord PerfTestSpatialHash::GetCellCoord(const AZ::Vector3& position) const
+    {
+        return CellCoord{
+            aznumeric_cast<int32_t>(AZStd::floor(position.GetX() * m_inverseCellSize)),
+            aznumeric_cast<int32_t>(AZStd::floor(position.GetY() * m_inverseCellSize)) };
+    }
+
+    PerfTestSpatialHash::CellKey PerfTestSpatialHash::GetCellKey(const CellCoord& cellCoord)
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(cellCoord.m_x)) << 32) | static_cast<uint32_t>(cellCoord.m_y);
+    }
+
+    PerfTestSpatialHash::CellCoord PerfTestSpatialHash::GetCellCoord(CellKey cellKey)
+    {
+        return CellCoord{ static_cast<int32_t>(cellKey >> 32), static_cast<int32_t>(cellKey & 0xFFFFFFFF) };
+    }
+
+    void PerfTestSpatialHash::ReleaseCell(CellKey cellKey)
+    {
+        const auto cellIter = m_cellObjectCounts.find(cellKey);
+        if (cellIter != m_cellObjectCounts.end() && (--cellIter->second == 0))
+        {
+            m_cellObjectCounts.erase(cellIter);
+        }
+    }
+
+    void PerfTestSpatialHash::ReportStats()
+    {
+        if (!m_statsReport.ShouldReport(sv_perfTestSpatialHashStatsIntervalMs))
+        {
+            return;
+        }
+
+        AZLOG_INFO(
+            "Perf test spatial hash: %zu objects in %zu cells, %u updates, %u cell changes, %.3f ms total update time",
+            m_objectCells.size(), m_cellObjectCounts.size(), m_updateStats.m_updates, m_updateStats.m_cellChanges,
+            static_cast<double>(m_updateStats.m_updateTime) / 1000.0);
+
+        m_updateStats = UpdateStats{};
+    }
+
+    void PerfTestSpatialHash::RunBenchmark(uint32_t objectCount, uint32_t connectionCount, uint32_t tickCount, float areaSize)
+    {
+        // Matches the 30 Hz server tick the perf test objects move on
+        constexpr float TickSeconds = 1.0f / 30.0f;
+        constexpr float MaxSpeed = 5.0f;
+
+        PerfTestSpatialHash spatialHash;
+        spatialHash.LoadSettings();
+
+        // Fixed LCG, so every run moves the objects the same way
+        uint32_t randomState = 1;
+        const auto random01 = [&randomState]()
+        {
+            randomState = randomState * 1664525u + 1013904223u;
+            return static_cast<float>(randomState >> 8) / static_cast<float>(1u << 24);
+        };
+
+        struct BenchmarkObject
+        {
+            AZ::EntityId m_entityId;
+            AZ::Vector3 m_position;
+            AZ::Vector3 m_velocity;
+        };
+        AZStd::vector<BenchmarkObject> objects(objectCount);
+        for (uint32_t objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+        {
+            BenchmarkObject& object = objects[objectIndex];
+            object.m_entityId = AZ::EntityId(objectIndex + 1);
+            object.m_position = AZ::Vector3(random01() * areaSize, random01() * areaSize, 0.0f);
+            object.m_velocity = AZ::Vector3((random01() * 2.0f - 1.0f) * MaxSpeed, (random01() * 2.0f - 1.0f) * MaxSpeed, 0.0f);
+            spatialHash.UpdateObject(object.m_entityId, object.m_position);
+        }
+
+        AZStd::vector<AZ::Vector3> viewPositions(connectionCount);
+        for (AZ::Vector3& viewPosition : viewPositions)
+        {
+            viewPosition = AZ::Vector3(random01() * areaSize, random01() * areaSize, 0.0f);
+        }
+
+        AZStd::chrono::steady_clock::duration updateTime{};
+        AZStd::chrono::steady_clock::duration filterTime{};
+        uint64_t relevantPairs = 0;
+        spatialHash.m_updateStats = UpdateStats{};
+        for (uint32_t tick = 0; tick < tickCount; ++tick)
+        {
+            const auto updateStart = AZStd::chrono::steady_clock::now();
+            for (BenchmarkObject& object : objects)
+            {
+                object.m_position += object.m_velocity * TickSeconds;
+                // Bounce off the area edges, so the object density stays constant
+                if ((object.m_position.GetX() < 0.0f) || (object.m_position.GetX() > areaSize))
+                {
+                    object.m_velocity.SetX(-object.m_velocity.GetX());
+                }
+                if ((object.m_position.GetY() < 0.0f) || (object.m_position.GetY() > areaSize))
+                {
+                    object.m_velocity.SetY(-object.m_velocity.GetY());
+                }
+                spatialHash.UpdateObject(object.m_entityId, object.m_position);
+            }
+            const auto filterStart = AZStd::chrono::steady_clock::now();
+            for (const AZ::Vector3& viewPosition : viewPositions)
+            {
+                for (const BenchmarkObject& object : objects)
+                {
+                    relevantPairs += spatialHash.IsObjectNear(object.m_entityId, viewPosition) ? 1 : 0;
+                }
+            }
+            const auto filterEnd = AZStd::chrono::steady_clock::now();
+
+            updateTime += filterStart - updateStart;
+            filterTime += filterEnd - filterStart;
+        }
+
+        const auto toMicroseconds = [](AZStd::chrono::steady_clock::duration duration)
+        {
+            return static_cast<double>(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(duration).count()) / 1000.0;
+        };
+        const double ticks = AZStd::max(static_cast<double>(tickCount), 1.0);
+        const double pairs = AZStd::max(ticks * connectionCount * objectCount, 1.0);
+        const double relevantPerConnection = static_cast<double>(relevantPairs) / AZStd::max(ticks * connectionCount, 1.0);
+        AZLOG_INFO("Perf test spatial hash benchmark, %u objects in a %.0f m area, %u connections over %u ticks: "
+            "%.3f us per tick updating (%u cell changes), %.3f us per tick filtering (%.2f ns per pair), "
+            "%.1f of %u objects replicated per connection (%.1f%%)",
+            objectCount, areaSize, connectionCount, tickCount,
+            toMicroseconds(updateTime) / ticks, spatialHash.m_updateStats.m_cellChanges,
+            toMicroseconds(filterTime) / ticks, toMicroseconds(filterTime) * 1000.0 / pairs,
+            relevantPerConnection, objectCount, 100.0 * relevantPerConnection / AZStd::max(static_cast<double>(objectCount), 1.0));
+    }
+
+    static void BenchmarkPerfTestSpatialHash(const AZ::ConsoleCommandContainer& arguments)
+    {
+        uint32_t objectCount = 0;
+        uint32_t connectionCount = 10;
+        uint32_t tickCount = 300;
+        float areaSize = 1000.0f;
+        if (arguments.size() > 0)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(objectCount, arguments[0]);
+        }
+        if (arguments.size() > 1)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(connectionCount, arguments[1]);
+        }
+        if (arguments.size() > 2)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(tickCount, arguments[2]);
+        }
+        if (arguments.size() > 3)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(areaSize, arguments[3]);
+        }
+
+        if (objectCount > 0)
+        {
+            PerfTestSpatialHash::RunBenchmark(objectCount, connectionCount, tickCount, areaSize);
+        }
+        else
+        {
+            for (const uint32_t defaultObjectCount : { 5000u, 10000u, 20000u })
+            {
+                PerfTestSpatialHash::RunBenchmark(defaultObjectCount, connectionCount, tickCount, areaSize);
+            }
+        }
+    }
+    AZ_CONSOLEFREEFUNC(BenchmarkPerfTestSpatialHash, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Benchmarks the perf test spatial hash, takes an object count, connection count, tick count and area size in meters "
+        "(defaults to 5000, 10000 and 20000 objects, 10 connections, 300 ticks and 1000 m)");
+#endif
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <Source/PeriodicStats.h>
+
+namespace MultiplayerSample
+{
+#if AZ_TRAIT_SERVER
+    //! Uniform grid over the XY plane holding the server's moving perf test objects.
+    //! Objects push their own position whenever they move, and only touch the grid when they cross into a new cell.
+    //! The entity filter (ExampleFilteredEntityComponent on the level) uses it to only replicate objects within a few cells of each
+    //! connection's controlled entity. It is off by default; while disabled the interface stays unregistered and every perf test object replicates.
+    class PerfTestSpatialHash
+    {
+    public:
+        AZ_RTTI(PerfTestSpatialHash, "{0E5F8C31-7A2B-4E7C-9D53-2C8B6A41F1E7}");
+
+        PerfTestSpatialHash() = default;
+        virtual ~PerfTestSpatialHash() = default;
+
+        void Activate();
+        void Deactivate();
+
+        //! Adds the object if it isn't tracked yet, otherwise moves it to the cell containing the new position.
+        void UpdateObject(AZ::EntityId entityId, const AZ::Vector3& position);
+        void RemoveObject(AZ::EntityId entityId);
+
+        bool IsTracked(AZ::EntityId entityId) const;
+
+        //! Returns true if the object's cell is within the relevancy cell range of the given position.
+        //! Untracked objects are always considered near.
+        bool IsObjectNear(AZ::EntityId entityId, const AZ::Vector3& position) const;
+
+        //! Moves objects around a square area with a standalone hash configured from the settings registry, and times the grid updates
+        //! and the per connection filter queries. Also reports how many objects each connection still receives, which is what
+        //! the per client sync bandwidth scales with.
+        static void RunBenchmark(uint32_t objectCount, uint32_t connectionCount, uint32_t tickCount, float areaSize);
+
+    private:
+        using CellKey = uint64_t;
+
+        struct CellCoord
+        {
+            int32_t m_x = 0;
+            int32_t m_y = 0;
+        };
+
+        CellCoord GetCellCoord(const AZ::Vector3& position) const;
+        static CellKey GetCellKey(const CellCoord& cellCoord);
+        static CellCoord GetCellCoord(CellKey cellKey);
+
+        //! Returns whether the hash is enabled in the settings registry, and applies the grid settings.
+        bool LoadSettings();
+        void ReleaseCell(CellKey cellKey);
+        void ReportStats();
+
+        // Which cell each tracked object is in
+        AZStd::unordered_map<AZ::EntityId, CellKey> m_objectCells;
+
+        // Number of objects per occupied cell
+        AZStd::unordered_map<CellKey, uint32_t> m_cellObjectCounts;
+
+        float m_inverseCellSize = 1.0f / 16.0f;
+        int32_t m_relevancyCells = 4;
+        bool m_registered = false;
+
+        //! Update cost, tracked when sv_perfTestSpatialHashStats is enabled.
+        struct UpdateStats
+        {
+            uint32_t m_updates = 0;
+            uint32_t m_cellChanges = 0;
+            AZ::TimeUs m_updateTime = AZ::Time::ZeroTimeUs;
+        };
+        UpdateStats m_updateStats;
+        PeriodicStats m_statsReport;
+    };
+#endif
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/EditContext.h>
+#include <Components/QuantizedTransformBoundsComponent.h>
+
+namespace MultiplayerSample
+{
+    // Used when the level doesn't define its own bounds, at 16 bits per axis this is about 1.5cm of horizontal precision
+    static AZ::Aabb GetDefaultQuantizationBounds()
+    {
+        return AZ::Aabb::CreateFromMinMax(AZ::Vector3(-512.0f, -512.0f, -64.0f), AZ::Vector3(512.0f, 512.0f, 192.0f));
+    }
+
+    void QuantizedTransformBoundsComponent::Reflect(AZ::ReflectContext* context)
+    {
+        AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serializeContext)
+        {
+            serializeContext->Class<QuantizedTransformBoundsComponent, AZ::Component>()
+                ->Field("Min", &QuantizedTransformBoundsComponent::m_min)
+                ->Field("Max", &QuantizedTransformBoundsComponent::m_max)
+                ->Version(1);
+
+            if (AZ::EditContext* editContext = serializeContext->GetEditContext())
+            {
+                using namespace AZ::Edit;
+                editContext->Class<QuantizedTransformBoundsComponent>("QuantizedTransformBoundsComponent",
+                    "World bounds used to quantize the positions of entities with a NetworkQuantizedTransformComponent")
+                    ->ClassElement(ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::Category, "MultiplayerSample")
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Level"))
+                    ->DataElement(nullptr, &QuantizedTransformBoundsComponent::m_min, "Min", "The minimum corner of the quantization bounds")
+                    ->DataElement(nullptr, &QuantizedTransformBoundsComponent::m_max, "Max", "The maximum corner of the quantization bounds")
+                ;
+            }
+        }
+    }
+
+    QuantizedTransformBoundsComponent::QuantizedTransformBoundsComponent()
+        : m_min(GetDefaultQuantizationBounds().GetMin())
+        , m_max(GetDefaultQuantizationBounds().GetMax())
+    {
+    }
+
+    void QuantizedTransformBoundsComponent::Activate()
+    {
+        AZ_Warning("QuantizedTransformBoundsComponent", m_min.IsLessThan(m_max),
+            "Quantization bounds on entity %s are empty, the default bounds will be used", GetEntity()->GetName().c_str());
+        AZ::Interface<QuantizedTransformBoundsComponent>::Register(this);
+    }
+
+    void QuantizedTransformBoundsComponent::Deactivate()
+    {
+        AZ::Interface<QuantizedTransformBoundsComponent>::Unregister(this);
+    }
+
+    AZ::Aabb QuantizedTransformBoundsComponent::GetQuantizationBounds()
+    {
+        const QuantizedTransformBoundsComponent* bounds = AZ::Interface<QuantizedTransformBoundsComponent>::Get();
+        if (bounds && bounds->m_min.IsLessThan(bounds->m_max))
+        {
+            return AZ::Aabb::CreateFromMinMax(bounds->m_min, bounds->m_max);
+        }
+
+        return GetDefaultQuantizationBounds();
+    }
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Aabb.h>
+
+namespace MultiplayerSample
+{
+    //! Level component defining the volume NetworkQuantizedTransformComponent positions are quantized against.
+    //! Tighter bounds give more precision, positions outside of them are clamped to the edge.
+    class QuantizedTransformBoundsComponent final
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(MultiplayerSample::QuantizedTransformBoundsComponent, "{C4F0B7C9-2D63-4B8E-A1F5-7E3D9B62A0D4}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        QuantizedTransformBoundsComponent();
+
+        //! AZ::Component overrides.
+        //! @{
+        void Activate() override;
+        void Deactivate() override;
+        //! }@
+
+        //! Returns the active level's bounds, or the default bounds if the level doesn't have this component.
+        static AZ::Aabb GetQuantizationBounds();
+
+    private:
+        AZ::Vector3 m_min;
+        AZ::Vector3 m_max;
+    };
+}
@@ -8,6 +8,9 @@
 
 #include <Components/ScriptableDecalComponent.h>
 
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -18,6 +21,14 @@
 
 namespace MultiplayerSample
 {
+    AZ_CVAR(float, cl_decalStressSpawnRate, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Decals per second to spawn for stress testing. Replays the most recent spawned decal config around its spawn point; 0 disables stress mode");
+    AZ_CVAR(float, cl_decalStressRadius, 10.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Radius in meters that stress mode scatters decals in");
+    AZ_CVAR(AZ::CVarFixedString, cl_decalStressMaterial, "materials/decal/scorch_01_decal.azmaterial", nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Decal material stress mode spawns until a decal has been spawned by gameplay");
+    AZ_CVAR(bool, cl_decalStats, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, periodically logs the decal ring occupancy and update cost");
+    AZ_CVAR(AZ::TimeMs, cl_decalStatsIntervalMs, AZ::TimeMs{ 5000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "How often the decal stats are logged");
+
     void ScriptableDecalComponent::Reflect(AZ::ReflectContext* context)
     {
         SpawnDecalConfig::Reflect(context);
@@ -25,7 +36,8 @@ namespace MultiplayerSample
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serialize->Class<MultiplayerSample::ScriptableDecalComponent, AZ::Component>()
-                ->Version(0)
+                ->Version(1)
+                ->Field("MaxDecals", &ScriptableDecalComponent::m_maxDecals)
                 ;
 
             AZ::EditContext* editContext = serialize->GetEditContext();
@@ -36,6 +48,9 @@ namespace MultiplayerSample
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
                     ->Attribute(AZ::Edit::Attributes::Category, "Graphics")
                     ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZStd::vector<AZ::Crc32>({ AZ_CRC_CE("Level") }))
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &ScriptableDecalComponent::m_maxDecals, "Max decals",
+                        "Number of decals that can be visible at once. Decal handles are acquired as the ring first fills and then kept, and spawning past this limit replaces the oldest decal.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 1)
                     ;
             }
         }
@@ -70,6 +85,12 @@ namespace MultiplayerSample
         m_decalFeatureProcessor = AZ::RPI::Scene::GetFeatureProcessorForEntity<AZ::Render::DecalFeatureProcessorInterface>(GetEntityId());
         if (m_decalFeatureProcessor)
         {
+            // Handles are acquired the first time their slot is used and kept until deactivation, so expiring and respawning decals
+            // never acquires or releases feature processor slots, while slots that are never used cost no decal buffer or culling
+            m_decalHandles.resize(AZStd::max(m_maxDecals, 1u));
+            m_acquiredHandleCount = 0;
+            m_decalRing.Init(this, static_cast<uint32_t>(m_decalHandles.size()));
+
             AZ::RPI::Scene* scene = m_decalFeatureProcessor->GetParentScene();
             DecalRequestBus::Handler::BusConnect(scene->GetId());
             AZ::TickBus::Handler::BusConnect();
@@ -81,28 +102,22 @@ namespace MultiplayerSample
         AZ::TickBus::Handler::BusDisconnect();
         DecalRequestBus::Handler::BusDisconnect();
 
-        auto removeDecalsFromList = [&](AZStd::vector<DecalInstance>& container)
+        m_decalRing.Clear();
+        for (DecalHandle& handle : m_decalHandles)
         {
-            for (const DecalInstance& instance : container)
+            if (handle.IsValid())
             {
-                m_decalFeatureProcessor->ReleaseDecal(instance.m_handle);
+                m_decalFeatureProcessor->ReleaseDecal(handle);
             }
-            container.clear();
-        };
-
-        removeDecalsFromList(m_fadingInDecals);
-        removeDecalsFromList(m_fadingOutDecals);
-        removeDecalsFromList(m_decalHeap);
+        }
+        m_decalHandles.clear();
+        m_acquiredHandleCount = 0;
 
         m_decalFeatureProcessor = nullptr;
     }
 
     void ScriptableDecalComponent::SpawnDecal(const AZ::Transform& worldTm, const SpawnDecalConfig& config)
     {
-        DecalHandle handle = m_decalFeatureProcessor->AcquireDecal();
-
-        AZ::Vector3 scale = AZ::Vector3(config.m_scale, config.m_scale, config.m_scale * config.m_thickness);
-
         // Check for bad state.
         if (config.m_scale <= 0.0f || !config.m_materialAssetId.IsValid() || config.m_opacity <= 0.0f ||
             (config.m_fadeInTimeSec + config.m_lifeTimeSec + config.m_fadeOutTimeSec <= 0.0f))
@@ -110,110 +125,132 @@ namespace MultiplayerSample
             return;
         }
 
+        m_stressConfig = config;
+        m_stressOrigin = worldTm;
+        m_decalRing.Spawn(worldTm, config, static_cast<uint32_t>(AZ::Interface<AZ::ITime>::Get()->GetElapsedTimeMs()));
+    }
+
+    void ScriptableDecalComponent::ShowDecal(uint32_t slot, const AZ::Transform& worldTm, const SpawnDecalConfig& config, float opacity)
+    {
+        DecalHandle& handle = m_decalHandles[slot];
+        if (!handle.IsValid())
+        {
+            handle = m_decalFeatureProcessor->AcquireDecal();
+            ++m_acquiredHandleCount;
+        }
+
+        AZ::Vector3 scale = AZ::Vector3(config.m_scale, config.m_scale, config.m_scale * config.m_thickness);
+
         m_decalFeatureProcessor->SetDecalTransform(handle, worldTm, scale);
         m_decalFeatureProcessor->SetDecalMaterial(handle, config.m_materialAssetId);
-        m_decalFeatureProcessor->SetDecalOpacity(handle, config.m_opacity);
+        m_decalFeatureProcessor->SetDecalOpacity(handle, opacity);
         m_decalFeatureProcessor->SetDecalAttenuationAngle(handle, config.m_attenuationAngle);
         m_decalFeatureProcessor->SetDecalSortKey(handle, config.m_sortKey);
+    }
 
-        uint32_t currentTimeMs = static_cast<uint32_t>(AZ::Interface<AZ::ITime>::Get()->GetElapsedTimeMs());
+    void ScriptableDecalComponent::SetDecalOpacity(uint32_t slot, float opacity)
+    {
+        m_decalFeatureProcessor->SetDecalOpacity(m_decalHandles[slot], opacity);
+    }
 
-        if (config.m_fadeInTimeSec > 0.0f)
+    void ScriptableDecalComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (cl_decalStressSpawnRate > 0.0f)
         {
-            m_fadingInDecals.push_back({ config, handle, currentTimeMs });
+            SpawnStressDecals(deltaTime);
         }
-        else if (config.m_lifeTimeSec > 0.0f)
+
+        if (cl_decalStats)
         {
-            uint32_t lifetimeMs = static_cast<uint32_t>(config.m_lifeTimeSec * 1000.0f);
-            uint32_t despawnTimeMs = currentTimeMs + lifetimeMs;
+            ReportStats();
+        }
 
-            // Store decals in a min heap sorted by when they need to start animating the fade out.
-            // This makes it very cheap to check each frame if any decals need to change to the fade-out state.
-            m_decalHeap.push_back({ config, handle, despawnTimeMs });
-            AZStd::push_heap(m_decalHeap.begin(), m_decalHeap.end(), HeapCompare);
+        if (m_decalRing.GetActiveDecalCount() == 0)
+        {
+            return;
         }
-        else
+
+        const AZ::TimeUs startTime = cl_decalStats ? AZ::GetElapsedTimeUs() : AZ::Time::ZeroTimeUs;
+
+        m_decalRing.Update(static_cast<uint32_t>(AZ::Interface<AZ::ITime>::Get()->GetElapsedTimeMs()));
+
+        if (cl_decalStats)
         {
-            m_fadingOutDecals.push_back({ config, handle, currentTimeMs });
+            ++m_updateStats.m_ticks;
+            m_updateStats.m_updateTime += AZ::GetElapsedTimeUs() - startTime;
         }
     }
 
-    void ScriptableDecalComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    void ScriptableDecalComponent::SpawnStressDecals(float deltaTime)
     {
-        uint32_t currentTimeMs = static_cast<uint32_t>(AZ::Interface<AZ::ITime>::Get()->GetElapsedTimeMs());
-
-        for (size_t i = 0; i < m_fadingInDecals.size();)
+        if (!m_stressConfig.has_value())
         {
-            DecalInstance& decalInstance = m_fadingInDecals.at(i);
-            uint32_t currentFadeTimeMs = currentTimeMs - decalInstance.m_animationStartTimeMs;
-            float fadeInTimeMsFloat = decalInstance.m_config.m_fadeInTimeSec * 1000.0f;
-
-            float opacity = AZStd::GetMin(1.0f, currentFadeTimeMs / fadeInTimeMsFloat);
-            opacity *= decalInstance.m_config.m_opacity;
-            m_decalFeatureProcessor->SetDecalOpacity(decalInstance.m_handle, opacity);
-
-            uint32_t fadeInTimeMs = static_cast<uint32_t>(fadeInTimeMsFloat);
-            if (currentFadeTimeMs > fadeInTimeMs)
+            if (m_defaultStressConfigMissing)
             {
-                uint32_t lifetimeMs = static_cast<uint32_t>(decalInstance.m_config.m_lifeTimeSec * 1000.0f);
-                // Fade out animation starts after the fade in time and life time have passed.
-                uint32_t despawnTimeMs = fadeInTimeMs + lifetimeMs; 
-                decalInstance.m_animationStartTimeMs += despawnTimeMs;
-
-                m_decalHeap.push_back(decalInstance);
-                AZStd::push_heap(m_decalHeap.begin(), m_decalHeap.end(), HeapCompare);
-
-                // Replace this instance with the one on the back
-                decalInstance = m_fadingInDecals.back();
-                m_fadingInDecals.pop_back();
-
-                // Don't increment, next iteration needs to process the item just moved to this spot.
+                return;
             }
-            else
+
+            m_stressConfig = CreateDefaultStressConfig();
+            if (!m_stressConfig.has_value())
             {
-                ++i;
+                m_defaultStressConfigMissing = true;
+                return;
             }
         }
 
-        // Check to see if any decals need to despawn
-        while (!m_decalHeap.empty() && m_decalHeap.front().m_animationStartTimeMs < currentTimeMs)
+        m_stressSpawnAccumulator += cl_decalStressSpawnRate * deltaTime;
+        const int spawnCount = static_cast<int>(m_stressSpawnAccumulator);
+        m_stressSpawnAccumulator -= static_cast<float>(spawnCount);
+
+        const SpawnDecalConfig& config = m_stressConfig.value();
+        const uint32_t currentTimeMs = static_cast<uint32_t>(AZ::Interface<AZ::ITime>::Get()->GetElapsedTimeMs());
+        for (int i = 0; i < spawnCount; ++i)
         {
-            AZStd::pop_heap(m_decalHeap.begin(), m_decalHeap.end(), HeapCompare);
-            m_fadingOutDecals.push_back(m_decalHeap.back());
-            m_decalHeap.pop_back();
+            const AZ::Vector3 offset(
+                (m_stressRandom.GetRandomFloat() * 2.0f - 1.0f) * cl_decalStressRadius,
+                (m_stressRandom.GetRandomFloat() * 2.0f - 1.0f) * cl_decalStressRadius,
+                0.0f);
+            AZ::Transform worldTm = m_stressOrigin;
+            worldTm.SetTranslation(m_stressOrigin.GetTranslation() + offset);
+            m_decalRing.Spawn(worldTm, config, currentTimeMs);
         }
+    }
 
-        // Animate despawning decals, remove those that are expired.
-        for (size_t i = 0; i < m_fadingOutDecals.size();)
+    AZStd::optional<SpawnDecalConfig> ScriptableDecalComponent::CreateDefaultStressConfig()
+    {
+        const AZ::CVarFixedString materialPath = cl_decalStressMaterial;
+        AZ::Data::AssetId materialAssetId;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+            materialAssetId, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath, materialPath.c_str(), AZ::Data::s_invalidAssetType, false);
+        if (!materialAssetId.IsValid())
         {
-            DecalInstance& decalInstance = m_fadingOutDecals.at(i);
-
-            // Clamp our minimum total fade time to 1 millisecond to avoid any potential divide-by-zero
-            float totalFadeTimeMs = AZStd::max(decalInstance.m_config.m_fadeOutTimeSec * 1000.0f, 1.0f);
-            float currentFadeTimeMs = static_cast<float>(currentTimeMs - decalInstance.m_animationStartTimeMs);
-            if (currentFadeTimeMs > totalFadeTimeMs)
-            {
-                // Despawn the decal, it's done animating;
-                m_decalFeatureProcessor->ReleaseDecal(decalInstance.m_handle);
-
-                // Replace this instance with the one on the back
-                decalInstance = m_fadingOutDecals.back();
-                m_fadingOutDecals.pop_back();
-
-                // Don't increment, next iteration needs to process the item just moved to this spot.
-            }
-            else
-            {
-                float opacity = 1.0f - (currentFadeTimeMs / totalFadeTimeMs);
-                opacity *= decalInstance.m_config.m_opacity;
-                m_decalFeatureProcessor->SetDecalOpacity(decalInstance.m_handle, opacity);
-                ++i;
-            }
+            AZLOG_WARN("Decal stress material %s was not found, no stress decals are spawned until a decal is spawned", materialPath.c_str());
+            return AZStd::nullopt;
         }
+
+        SpawnDecalConfig config;
+        config.m_materialAssetId = materialAssetId;
+        config.m_lifeTimeSec = 2.0f;
+        return config;
     }
 
-    bool ScriptableDecalComponent::HeapCompare(const DecalInstance& value1, const DecalInstance& value2)
+    void ScriptableDecalComponent::ReportStats()
     {
-        return value1.m_animationStartTimeMs > value2.m_animationStartTimeMs;
+        if (!m_statsReport.ShouldReport(cl_decalStatsIntervalMs))
+        {
+            return;
+        }
+
+        const double averageUpdateMs = m_updateStats.m_ticks > 0
+            ? static_cast<double>(m_updateStats.m_updateTime) / 1000.0 / m_updateStats.m_ticks
+            : 0.0;
+        const DecalRing::Stats& ringStats = m_decalRing.GetStats();
+        AZLOG_INFO(
+            "Decals: %u active (peak %u) of %u slots, %u handles acquired, %u spawned, %u stolen, %u opacity updates, %.4f ms average update per tick",
+            m_decalRing.GetActiveDecalCount(), ringStats.m_peakActiveDecals, m_decalRing.GetSlotCount(), m_acquiredHandleCount, ringStats.m_spawns,
+            ringStats.m_stolen, ringStats.m_opacityUpdates, averageUpdateMs);
+
+        m_updateStats = UpdateStats{};
+        m_decalRing.ResetStats();
     }
 }
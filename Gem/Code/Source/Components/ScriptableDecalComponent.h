@@ -11,7 +11,12 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/EBus/Event.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/optional.h>
+#include <Components/DecalRing.h>
 #include <DecalBus.h>
+#include <Source/PeriodicStats.h>
 
 #include <Atom/Feature/Decals/DecalFeatureProcessorInterface.h>
 
@@ -22,6 +27,7 @@ namespace MultiplayerSample
         : public AZ::Component
         , public DecalRequestBus::Handler
         , public AZ::TickBus::Handler
+        , private IDecalRingTarget
     {
     public:
         AZ_COMPONENT(MultiplayerSample::ScriptableDecalComponent, "{79AEB56C-E886-4A6A-9BAA-0FE5D6D01F78}");
@@ -38,25 +44,50 @@ namespace MultiplayerSample
 
         using DecalHandle = AZ::Render::DecalFeatureProcessorInterface::DecalHandle;
 
-        struct DecalInstance
-        {
-            SpawnDecalConfig m_config;
-            DecalHandle m_handle;
-            uint32_t m_animationStartTimeMs = 0;
-        };
-
         // DecalRequestBus::Handler...
         void SpawnDecal(const AZ::Transform& worldTm, const SpawnDecalConfig& config) override;
 
         // TickBus::Handler...
         virtual void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
-        static bool HeapCompare(const DecalInstance& value1, const DecalInstance& value2);
+        // IDecalRingTarget...
+        void ShowDecal(uint32_t slot, const AZ::Transform& worldTm, const SpawnDecalConfig& config, float opacity) override;
+        void SetDecalOpacity(uint32_t slot, float opacity) override;
+
+        //! Stress mode: re-spawns the most recent decal config around its last spawn point at cl_decalStressSpawnRate decals per second.
+        //! Until a decal has been spawned, it scatters cl_decalStressMaterial decals around the world origin.
+        void SpawnStressDecals(float deltaTime);
+
+        //! Builds the config stress mode uses before any decal has been spawned, or nullopt if cl_decalStressMaterial isn't in the catalog.
+        static AZStd::optional<SpawnDecalConfig> CreateDefaultStressConfig();
+
+        void ReportStats();
+
+        struct UpdateStats
+        {
+            AZ::TimeUs m_updateTime = AZ::Time::ZeroTimeUs;
+            uint32_t m_ticks = 0;
+        };
+        UpdateStats m_updateStats;
+        PeriodicStats m_statsReport;
 
         AZ::Render::DecalFeatureProcessorInterface* m_decalFeatureProcessor = nullptr;
 
-        AZStd::vector<DecalInstance> m_decalHeap;
-        AZStd::vector<DecalInstance> m_fadingInDecals;
-        AZStd::vector<DecalInstance> m_fadingOutDecals;
+        //! Number of decal handles kept in the ring; spawning past this steals the oldest decal.
+        //! Every handle in use stays in the decal feature processor's buffers and culling even while hidden, so keep this near the
+        //! number of decals that are actually visible at once.
+        uint32_t m_maxDecals = 64;
+
+        //! One per ring slot, acquired the first time the slot shows a decal and reused by every later decal spawned into it.
+        AZStd::vector<DecalHandle> m_decalHandles;
+        uint32_t m_acquiredHandleCount = 0;
+        DecalRing m_decalRing;
+
+        // Last real spawn, or the cl_decalStressMaterial default before one, replayed by the stress mode
+        AZStd::optional<SpawnDecalConfig> m_stressConfig;
+        bool m_defaultStressConfigMissing = false;      //!< Set once cl_decalStressMaterial failed to resolve, so it is only looked up once
+        AZ::Transform m_stressOrigin = AZ::Transform::CreateIdentity();
+        AZ::SimpleLcgRandom m_stressRandom;
+        float m_stressSpawnAccumulator = 0.0f;
     };
 }
@@ -25,8 +25,18 @@ namespace MultiplayerSample
     void HUDComponent::Deactivate()
     {
         m_waitForActiveNetworkMatchComponent.RemoveFromQueue();
+        m_updateFirstMatchTimer.RemoveFromQueue();
         m_roundNumberHandler.Disconnect();
         m_roundTimerHandler.Disconnect();
+        m_firstMatchStartHostTimeHandler.Disconnect();
+
+        m_displayedRoundNumberText.clear();
+        m_displayedRoundTimerText.clear();
+        m_displayedFirstMatchTimerText.clear();
+        m_roundSecondsRemainingEnabled.reset();
+        m_firstMatchStartingEnabled.reset();
+        m_roundSecondsRemainingUiElements.clear();
+        m_displayedSecondsRemainingIndex = -1;
     }
 
     void HUDComponent::Reflect(AZ::ReflectContext* context)
@@ -68,7 +78,7 @@ namespace MultiplayerSample
             // The end of match can push the round count over the max round count, so cap it.
             const uint16_t totalRounds = aznumeric_cast<uint16_t>(netMatchComponent->GetTotalRoundCount());
             m_roundNumberText = AZStd::string::format("%d of %d", AZStd::min(round, totalRounds), totalRounds);
-            UiTextBus::Event(m_roundNumberUi, &UiTextBus::Events::SetText, m_roundNumberText);
+            SetTextIfChanged(m_roundNumberUi, m_displayedRoundNumberText, m_roundNumberText);
         }
     }
 
@@ -80,23 +90,35 @@ namespace MultiplayerSample
         auto seconds = AZStd::chrono::duration_cast<AZStd::chrono::seconds>(duration - minutes);
 
         AZStd::string roundTimerText = AZStd::string::format("%02i:%02i", static_cast<int>(minutes.count()), static_cast<int>(seconds.count()));
-        UiTextBus::Event(m_roundTimerUi, &UiTextBus::Events::SetText, roundTimerText);
+        SetTextIfChanged(m_roundTimerUi, m_displayedRoundTimerText, roundTimerText);
 
         // Display a countdown of custom UI when the round is close to finishing
         if (duration.count() > 0 && duration.count() <= 10)
         {
-            UiElementBus::Event(m_roundSecondsRemainingUiParent, &UiElementBus::Events::SetIsEnabled, true);
+            SetEnabledIfChanged(m_roundSecondsRemainingUiParent, m_roundSecondsRemainingEnabled, true);
 
-            AZStd::vector<AZ::EntityId> uiSecondsRemainingUIElements;
-            UiElementBus::EventResult(uiSecondsRemainingUIElements, m_roundSecondsRemainingUiParent, &UiElementBus::Events::GetChildEntityIds);
-            for (int i = 0; i < uiSecondsRemainingUIElements.size(); ++i)
+            if (m_roundSecondsRemainingUiElements.empty())
             {
-                UiElementBus::Event(uiSecondsRemainingUIElements[i], &UiElementBus::Events::SetIsEnabled, i == aznumeric_cast<int>(duration.count()));
+                UiElementBus::EventResult(m_roundSecondsRemainingUiElements, m_roundSecondsRemainingUiParent, &UiElementBus::Events::GetChildEntityIds);
+            }
+
+            // Only the previously shown and the newly shown second need to change
+            const int secondsRemainingIndex = aznumeric_cast<int>(duration.count());
+            if (secondsRemainingIndex != m_displayedSecondsRemainingIndex)
+            {
+                for (int i = 0; i < m_roundSecondsRemainingUiElements.size(); ++i)
+                {
+                    if (i == secondsRemainingIndex || i == m_displayedSecondsRemainingIndex || m_displayedSecondsRemainingIndex < 0)
+                    {
+                        UiElementBus::Event(m_roundSecondsRemainingUiElements[i], &UiElementBus::Events::SetIsEnabled, i == secondsRemainingIndex);
+                    }
+                }
+                m_displayedSecondsRemainingIndex = secondsRemainingIndex;
             }
         }
         else
         {
-            UiElementBus::Event(m_roundSecondsRemainingUiParent, &UiElementBus::Events::SetIsEnabled, false);
+            SetEnabledIfChanged(m_roundSecondsRemainingUiParent, m_roundSecondsRemainingEnabled, false);
         }
     }
 
@@ -107,25 +129,42 @@ namespace MultiplayerSample
         // Update the UI to display the time remaining until the first match begins
         if (timeRemainingUntilMatchStartMs > AZ::Time::ZeroTimeMs)
         {
-            UiElementBus::Event(m_firstMatchStartingUiParent, &UiElementBus::Events::SetIsEnabled, true);
+            SetEnabledIfChanged(m_firstMatchStartingUiParent, m_firstMatchStartingEnabled, true);
 
             const AZStd::chrono::milliseconds duration(static_cast<long long>(timeRemainingUntilMatchStartMs));
             const auto minutes = AZStd::chrono::duration_cast<AZStd::chrono::minutes>(duration);
             const auto seconds = AZStd::chrono::duration_cast<AZStd::chrono::seconds>(duration - minutes);
 
             AZStd::string matchTimeText = AZStd::string::format("%02i:%02i", static_cast<int>(minutes.count()), static_cast<int>(seconds.count()));
-            UiTextBus::Event(m_firstMatchStartingTimerUi, &UiTextBus::Events::SetText, matchTimeText);
+            SetTextIfChanged(m_firstMatchStartingTimerUi, m_displayedFirstMatchTimerText, matchTimeText);
 
-            // Requeue to refresh the UI after a second if there's still time left on the clock
-            if (!m_updateFirstMatchTimer.IsScheduled())
-            {
-                m_updateFirstMatchTimer.Enqueue(AZ::SecondsToTimeMs(1.0), true);
-            }
+            // Wake up again right after the displayed second rolls over, rather than polling on a fixed interval
+            const AZ::TimeMs untilNextSecond = AZ::TimeMs{ static_cast<int64_t>(timeRemainingUntilMatchStartMs) % 1000 } + AZ::TimeMs{ 1 };
+            m_updateFirstMatchTimer.RemoveFromQueue();
+            m_updateFirstMatchTimer.Enqueue(untilNextSecond, false);
         }
         else
         {
-            UiElementBus::Event(m_firstMatchStartingUiParent, &UiElementBus::Events::SetIsEnabled, false);
+            SetEnabledIfChanged(m_firstMatchStartingUiParent, m_firstMatchStartingEnabled, false);
             m_updateFirstMatchTimer.RemoveFromQueue();
         }
     }
+
+    void HUDComponent::SetTextIfChanged(AZ::EntityId textElement, AZStd::string& displayedText, const AZStd::string& text)
+    {
+        if (displayedText != text)
+        {
+            UiTextBus::Event(textElement, &UiTextBus::Events::SetText, text);
+            displayedText = text;
+        }
+    }
+
+    void HUDComponent::SetEnabledIfChanged(AZ::EntityId element, AZStd::optional<bool>& displayedEnabled, bool enabled)
+    {
+        if (displayedEnabled != enabled)
+        {
+            UiElementBus::Event(element, &UiElementBus::Events::SetIsEnabled, enabled);
+            displayedEnabled = enabled;
+        }
+    }
 } // namespace MultiplayerSample
@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/EBus/Event.h>
+#include <AzCore/std/optional.h>
 #include <Source/Components/NetworkMatchComponent.h>
 
 #include "MultiplayerSampleTypes.h"
@@ -58,6 +59,10 @@ namespace MultiplayerSample
         void SetRoundTimerText(RoundTimeSec time);
         void UpdateFirstMatchTimerUi();
 
+        // LyShine invalidates layout on every SetText/SetIsEnabled, so only forward values that differ from what's displayed
+        static void SetTextIfChanged(AZ::EntityId textElement, AZStd::string& displayedText, const AZStd::string& text);
+        static void SetEnabledIfChanged(AZ::EntityId element, AZStd::optional<bool>& displayedEnabled, bool enabled);
+
         AZ::EventHandler<uint16_t> m_roundNumberHandler; 
         AZ::EventHandler<RoundTimeSec> m_roundTimerHandler;
         AZ::EventHandler<AZ::TimeMs> m_firstMatchStartHostTimeHandler;
@@ -66,6 +71,15 @@ namespace MultiplayerSample
                 UpdateFirstMatchTimerUi();
             }, AZ::Name("HUDComponent Update First Match Timer"));
 
+        // What the HUD currently displays
+        AZStd::string m_displayedRoundNumberText;
+        AZStd::string m_displayedRoundTimerText;
+        AZStd::string m_displayedFirstMatchTimerText;
+        AZStd::optional<bool> m_roundSecondsRemainingEnabled;
+        AZStd::optional<bool> m_firstMatchStartingEnabled;
+        AZStd::vector<AZ::EntityId> m_roundSecondsRemainingUiElements;
+        int m_displayedSecondsRemainingIndex = -1;
+
         AZ::EntityId m_roundNumberUi;
         AZ::EntityId m_roundTimerUi;
         AZStd::string m_roundNumberText;
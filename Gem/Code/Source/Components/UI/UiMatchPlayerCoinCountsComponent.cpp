@@ -7,7 +7,7 @@
  */
 
 #include <AzCore/Serialization/EditContext.h>
-#include <AzCore/std/sort.h>
+#include <AzCore/std/algorithm.h>
 
 #include <Source/Components/Multiplayer/MatchPlayerCoinsComponent.h>
 #include <Components/Multiplayer/PlayerIdentityComponent.h>
@@ -26,73 +26,196 @@ namespace MultiplayerSample
 
     void UiMatchPlayerCoinCountsComponent::Activate()
     {
+        m_slotPlayerIds.fill(Multiplayer::InvalidNetEntityId);
         m_waitForActiveNetworkMatchComponent.Enqueue(AZ::TimeMs{ 1000 }, true);
         StartingPointInput::InputEventNotificationBus::MultiHandler::BusConnect(ShowPlayerCoinCountsEventId);
+        PlayerIdentityNotificationBus::Handler::BusConnect();
     }
 
     void UiMatchPlayerCoinCountsComponent::Deactivate()
     {
+        PlayerIdentityNotificationBus::Handler::BusDisconnect();
         StartingPointInput::InputEventNotificationBus::MultiHandler::BusDisconnect();
         m_waitForActiveNetworkMatchComponent.RemoveFromQueue();
         m_roundTimerHandler.Disconnect();
+        m_onPlayerScoreChanged.Disconnect();
+        m_refreshPlayerScoreUI.RemoveFromQueue();
+        m_sortedScores.clear();
+        m_displayedRows.clear();
+        m_sortedCoinsVersion = InvalidCoinsVersion;
     }
 
-    void UiMatchPlayerCoinCountsComponent::UpdatePlayerScoreUI()
+    void UiMatchPlayerCoinCountsComponent::OnPlayerNameChanged(Multiplayer::NetEntityId playerEntity, const char* playerName)
     {
-        // Display player scores sorted by coin count (highest score on top)
-        AZStd::vector<PlayerCoinState> coins = AZ::Interface<MatchPlayerCoinsComponent>::Get()->GetPlayerCoinCounts();
-        AZStd::sort(coins.begin(), coins.end(), [](const PlayerCoinState& a, const PlayerCoinState& b) {return a.m_coins > b.m_coins; });
-
-        AZStd::size_t elementIndex = 0;
-        for (const PlayerCoinState& state : coins)
+        for (ScoreEntry& entry : m_sortedScores)
         {
-            if (elementIndex >= m_playerRowElement.size())
+            if (entry.m_playerId == playerEntity)
             {
-                AZ_Error("UiMatchPlayerCoinCounts", false, "Failed to update score screen. Please update UICanvas so there are enough player rows.")
+                entry.m_playerName = (playerName && playerName[0] != '\0') ? playerName : "<player_identity_empty>";
+                if (m_onPlayerScoreChanged.IsConnected() && !m_refreshPlayerScoreUI.IsScheduled())
+                {
+                    m_refreshPlayerScoreUI.Enqueue(AZ::Time::ZeroTimeMs);
+                }
                 break;
             }
+        }
+    }
 
-            AZStd::vector<AZ::EntityId> children;
-            UiElementBus::EventResult(children, m_playerRowElement[elementIndex], &UiElementBus::Events::GetChildEntityIds);
+    void UiMatchPlayerCoinCountsComponent::RebuildSortedScores(const MatchPlayerCoinsComponent::PlayerCoinCountsView& coinCounts)
+    {
+        m_sortedScores.clear();
+        m_slotPlayerIds.fill(Multiplayer::InvalidNetEntityId);
 
-            if (children.size() < 3)
+        const size_t slotCount = AZStd::min(coinCounts.m_coins.size(), m_slotPlayerIds.size());
+        for (size_t slotIndex = 0; slotIndex < slotCount; ++slotIndex)
+        {
+            const PlayerCoinState& state = coinCounts.m_coins[slotIndex];
+            m_slotPlayerIds[slotIndex] = state.m_playerId;
+            if (state.m_playerId != Multiplayer::InvalidNetEntityId)
             {
-                AZ_Error("UiMatchPlayerCoinCounts", false, "Failed to update score screen. Please update UICanvas so the player row has at least 3 child elements for setting the player name, coin count, and player highlight.")
-                break;
+                InsertScoreEntry(ScoreEntry{ state.m_playerId, state.m_coins, GetPlayerName(state.m_playerId) });
             }
+        }
+
+        m_sortedCoinsVersion = coinCounts.m_version;
+    }
+
+    void UiMatchPlayerCoinCountsComponent::OnPlayerScoreChanged(int32_t slotIndex, const PlayerCoinState& state)
+    {
+        if (slotIndex < 0 || slotIndex >= aznumeric_cast<int32_t>(m_slotPlayerIds.size()))
+        {
+            return;
+        }
+
+        const Multiplayer::NetEntityId previousPlayerId = m_slotPlayerIds[slotIndex];
+        m_slotPlayerIds[slotIndex] = state.m_playerId;
+
+        // Pull the slot's previous entry out of the sorted order, keeping its name if the same player is still in the slot
+        ScoreEntry entry{ state.m_playerId, state.m_coins };
+        const auto previousEntry = AZStd::find_if(m_sortedScores.begin(), m_sortedScores.end(), [previousPlayerId](const ScoreEntry& sortedEntry)
+        {
+            return sortedEntry.m_playerId == previousPlayerId;
+        });
+        if (previousEntry != m_sortedScores.end())
+        {
+            if (previousPlayerId == state.m_playerId)
+            {
+                entry.m_playerName = previousEntry->m_playerName;
+            }
+            m_sortedScores.erase(previousEntry);
+        }
+
+        if (state.m_playerId != Multiplayer::InvalidNetEntityId)
+        {
+            if (entry.m_playerName.empty())
+            {
+                entry.m_playerName = GetPlayerName(state.m_playerId);
+            }
+            InsertScoreEntry(entry);
+        }
+
+        if (!m_refreshPlayerScoreUI.IsScheduled())
+        {
+            m_refreshPlayerScoreUI.Enqueue(AZ::Time::ZeroTimeMs);
+        }
+    }
+
+    void UiMatchPlayerCoinCountsComponent::InsertScoreEntry(const ScoreEntry& entry)
+    {
+        // Highest score on top, a player tying with others goes below them so rows don't swap back and forth
+        const auto insertPosition = AZStd::upper_bound(m_sortedScores.begin(), m_sortedScores.end(), entry,
+            [](const ScoreEntry& a, const ScoreEntry& b) { return a.m_coins > b.m_coins; });
+        m_sortedScores.insert(insertPosition, entry);
+    }
+
+    void UiMatchPlayerCoinCountsComponent::CacheRowElements()
+    {
+        if (m_displayedRows.size() == m_playerRowElement.size())
+        {
+            return;
+        }
+
+        m_displayedRows.clear();
+        m_displayedRows.resize(m_playerRowElement.size());
+        for (AZStd::size_t rowIndex = 0; rowIndex < m_playerRowElement.size(); ++rowIndex)
+        {
+            AZStd::vector<AZ::EntityId> children;
+            UiElementBus::EventResult(children, m_playerRowElement[rowIndex], &UiElementBus::Events::GetChildEntityIds);
 
-            if (state.m_playerId == Multiplayer::InvalidNetEntityId)
+            if (children.size() < 3)
             {
+                AZ_Error("UiMatchPlayerCoinCounts", false, "Failed to update score screen. Please update UICanvas so the player row has at least 3 child elements for setting the player name, coin count, and player highlight.")
                 continue;
             }
 
-            const PlayerNameString name = GetPlayerName(state.m_playerId);
-            UiTextBus::Event(children[0], &UiTextBus::Events::SetText, name.c_str());
-            UiTextBus::Event(children[1], &UiTextBus::Events::SetText, AZStd::string::format("%d", state.m_coins));
+            DisplayedRow& row = m_displayedRows[rowIndex];
+            row.m_nameElement = children[0];
+            row.m_coinsElement = children[1];
+            row.m_highlightElement = children[2];
+            row.m_valid = true;
+        }
+    }
 
-            // Highlight the row belonging to this client's autonomous player
-            bool isAutonomousPlayer = false;
-            const Multiplayer::ConstNetworkEntityHandle playerHandle = Multiplayer::GetNetworkEntityManager()->GetEntity(state.m_playerId);
-            if (playerHandle.Exists() && playerHandle.GetNetBindComponent() != nullptr)
+    void UiMatchPlayerCoinCountsComponent::UpdatePlayerScoreUI()
+    {
+        if (m_onPlayerScoreChanged.IsConnected())
+        {
+            if (const MatchPlayerCoinsComponent* matchPlayerCoins = AZ::Interface<MatchPlayerCoinsComponent>::Get())
             {
-                isAutonomousPlayer = playerHandle.GetNetBindComponent()->IsNetEntityRoleAutonomous();
+                // Every slot event has been applied to the sorted order by now
+                m_sortedCoinsVersion = matchPlayerCoins->GetPlayerCoinCounts().m_version;
             }
-            UiElementBus::Event(children[2], &UiElementBus::Events::SetIsEnabled, isAutonomousPlayer);
+        }
+
+        CacheRowElements();
 
-            elementIndex++;
+        if (m_sortedScores.size() > m_displayedRows.size())
+        {
+            AZ_Error("UiMatchPlayerCoinCounts", false, "Failed to update score screen. Please update UICanvas so there are enough player rows.")
         }
 
-        // Clear out the unused fields.
-        for (; elementIndex < m_playerRowElement.size(); ++elementIndex)
+        // Only touch the UI elements whose displayed value actually changed
+        for (AZStd::size_t rowIndex = 0; rowIndex < m_displayedRows.size(); ++rowIndex)
         {
-            AZStd::vector<AZ::EntityId> children;
-            UiElementBus::EventResult(children, m_playerRowElement[elementIndex], &UiElementBus::Events::GetChildEntityIds);
-            if (children.size() >= 3)
+            DisplayedRow& row = m_displayedRows[rowIndex];
+            if (!row.m_valid)
+            {
+                continue;
+            }
+
+            PlayerNameString playerName;
+            int32_t coins = -1;
+            bool highlighted = false;
+            if (rowIndex < m_sortedScores.size())
+            {
+                const ScoreEntry& entry = m_sortedScores[rowIndex];
+                playerName = entry.m_playerName;
+                coins = entry.m_coins;
+
+                // Highlight the row belonging to this client's autonomous player
+                const Multiplayer::ConstNetworkEntityHandle playerHandle = Multiplayer::GetNetworkEntityManager()->GetEntity(entry.m_playerId);
+                if (playerHandle.Exists() && playerHandle.GetNetBindComponent() != nullptr)
+                {
+                    highlighted = playerHandle.GetNetBindComponent()->IsNetEntityRoleAutonomous();
+                }
+            }
+
+            if (!row.m_initialized || row.m_playerName != playerName)
+            {
+                UiTextBus::Event(row.m_nameElement, &UiTextBus::Events::SetText, playerName.c_str());
+                row.m_playerName = playerName;
+            }
+            if (!row.m_initialized || row.m_coins != coins)
             {
-                UiTextBus::Event(children[0], &UiTextBus::Events::SetText, ""); // name
-                UiTextBus::Event(children[1], &UiTextBus::Events::SetText, ""); // score
-                UiElementBus::Event(children[2], &UiElementBus::Events::SetIsEnabled, false); // autonomous player highlight
+                UiTextBus::Event(row.m_coinsElement, &UiTextBus::Events::SetText, (coins >= 0) ? AZStd::string::format("%d", coins) : AZStd::string());
+                row.m_coins = coins;
             }
+            if (!row.m_initialized || row.m_highlighted != highlighted)
+            {
+                UiElementBus::Event(row.m_highlightElement, &UiElementBus::Events::SetIsEnabled, highlighted);
+                row.m_highlighted = highlighted;
+            }
+            row.m_initialized = true;
         }
     }
 
@@ -104,13 +227,23 @@ namespace MultiplayerSample
         {
             if (!m_onPlayerScoreChanged.IsConnected())
             {
-                AZ::Interface<MatchPlayerCoinsComponent>::Get()->CoinsPerPlayerAddEvent(m_onPlayerScoreChanged);
+                if (MatchPlayerCoinsComponent* matchPlayerCoins = AZ::Interface<MatchPlayerCoinsComponent>::Get())
+                {
+                    // Slot events aren't followed while hidden, catch up in one go if any score changed since
+                    const MatchPlayerCoinsComponent::PlayerCoinCountsView coinCounts = matchPlayerCoins->GetPlayerCoinCounts();
+                    if (coinCounts.m_version != m_sortedCoinsVersion)
+                    {
+                        RebuildSortedScores(coinCounts);
+                    }
+                    matchPlayerCoins->CoinsPerPlayerAddEvent(m_onPlayerScoreChanged);
+                }
             }
             UpdatePlayerScoreUI();
         }
         else
         {
             m_onPlayerScoreChanged.Disconnect();
+            m_refreshPlayerScoreUI.RemoveFromQueue();
         }
     }
 
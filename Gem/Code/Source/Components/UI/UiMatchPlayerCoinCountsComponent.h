@@ -10,8 +10,13 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <Components/Multiplayer/MatchPlayerCoinsComponent.h>
 #include <Components/NetworkMatchComponent.h>
+#include <PlayerIdentityBus.h>
 #include <StartingPointInput/InputEventNotificationBus.h>
 
 namespace MultiplayerSample
@@ -19,6 +24,7 @@ namespace MultiplayerSample
     class UiMatchPlayerCoinCountsComponent
         : public AZ::Component
         , public StartingPointInput::InputEventNotificationBus::MultiHandler
+        , public PlayerIdentityNotificationBus::Handler
     {
     public:
         static constexpr float SecondsBeforeNewRoundToHideUI = 3.0f;
@@ -46,11 +52,58 @@ namespace MultiplayerSample
 
         static PlayerNameString GetPlayerName(Multiplayer::NetEntityId playerEntity);
 
+        //! PlayerIdentityNotificationBus overrides ...
+        //! @{
+        void OnPlayerNameChanged(Multiplayer::NetEntityId playerEntity, const char* playerName) override;
+        //! @}
+
+        struct ScoreEntry
+        {
+            Multiplayer::NetEntityId m_playerId = Multiplayer::InvalidNetEntityId;
+            uint16_t m_coins = 0;
+            PlayerNameString m_playerName;
+        };
+
+        //! What a row currently shows, so only the elements whose value changed get touched.
+        struct DisplayedRow
+        {
+            AZ::EntityId m_nameElement;
+            AZ::EntityId m_coinsElement;
+            AZ::EntityId m_highlightElement;
+            PlayerNameString m_playerName;
+            int32_t m_coins = -1;
+            bool m_highlighted = false;
+            bool m_valid = false;
+            bool m_initialized = false;
+        };
+
+        void RebuildSortedScores(const MatchPlayerCoinsComponent::PlayerCoinCountsView& coinCounts);
+        void OnPlayerScoreChanged(int32_t slotIndex, const PlayerCoinState& state);
+        void InsertScoreEntry(const ScoreEntry& entry);
+        void CacheRowElements();
         void UpdatePlayerScoreUI();
-        AZ::Event<int32_t, PlayerCoinState>::Handler m_onPlayerScoreChanged{[this](int32_t, PlayerCoinState)
+
+        // Scores sorted by coin count (highest score on top), kept in order by insertion as single scores change
+        AZStd::fixed_vector<ScoreEntry, MaxSupportedPlayers> m_sortedScores;
+
+        // Which player each MatchPlayerCoinsComponent slot held, so a slot change knows which entry to replace
+        AZStd::array<Multiplayer::NetEntityId, MaxSupportedPlayers> m_slotPlayerIds;
+
+        AZStd::vector<DisplayedRow> m_displayedRows;
+
+        // MatchPlayerCoinsComponent version that m_sortedScores reflects
+        static constexpr uint32_t InvalidCoinsVersion = AZStd::numeric_limits<uint32_t>::max();
+        uint32_t m_sortedCoinsVersion = InvalidCoinsVersion;
+
+        // Slots arrive one event at a time, refresh the rows once on the next tick after the whole update has been applied
+        AZ::Event<int32_t, PlayerCoinState>::Handler m_onPlayerScoreChanged{[this](int32_t slotIndex, const PlayerCoinState& state)
         {
-            UpdatePlayerScoreUI();
+            OnPlayerScoreChanged(slotIndex, state);
         } };
+        AZ::ScheduledEvent m_refreshPlayerScoreUI{ [this]()
+        {
+            UpdatePlayerScoreUI();
+        }, AZ::Name("UiMatchPlayerCoinCountsRefresh") };
 
         // Wait for NetworkMatchComponent to activate so we can begin listening for NetworkMatch events
         // For example: when the round resets to 1 we know the new match has started.
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/GameplayTrace.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+
+namespace MultiplayerSample
+{
+    //! Name and payload layout of a trace event, written into every trace dump so dumps decode without the build that wrote them.
+    struct TraceEventDescriptor
+    {
+        const char* m_name;
+        const char* m_payload; //!< Comma separated name:type pairs, where type is u32, u64 (two words), f32 or an enum name
+    };
+
+    // Indexed by TraceEvent, keep in sync with the enum and the argument types passed to MPS_TRACE
+    static constexpr TraceEventDescriptor TraceEventDescriptors[] =
+    {
+        { "WeaponStartFire", "weaponIndex:u32" },
+        { "WeaponStartFireRejected", "status:WeaponStatus,cooldownTime:f32" },
+        { "WeaponActivateRejected", "status:WeaponStatus,cooldownTime:f32" },
+        { "WeaponPredictedActivation", "weaponIndex:u32" },
+        { "WeaponSimulatedActivation", "weaponIndex:u32,backlog:u32,replayed:u32" },
+        { "WeaponPredictedHit", "hitNetEntityId:u64,x:f32,y:f32,z:f32" },
+        { "WeaponConfirmedHit", "hitNetEntityId:u64,x:f32,y:f32,z:f32" },
+        { "MovementInput", "clientInputId:u32,velocityX:f32,velocityY:f32,velocityZ:f32" },
+    };
+    static_assert(AZ_ARRAY_SIZE(TraceEventDescriptors) == static_cast<size_t>(TraceEvent::Count), "Every TraceEvent needs a descriptor");
+
+#if MPS_TRACE_LEVEL > 0
+    AZ_CVAR(AZ::CVarFixedString, mps_traceFile, "@user@/gameplay_trace.bin", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The file DumpGameplayTrace writes the gameplay trace ring to, decode it with scripts/decode_gameplay_trace.py");
+
+    static constexpr uint32_t TraceRecordCount = 1 << 14;
+    static constexpr char TraceFileMagic[8] = { 'M', 'P', 'S', 'T', 'R', 'A', 'C', 'E' };
+    static constexpr uint32_t TraceFileVersion = 2;
+
+    // Producers claim a slot with a single atomic increment; a dump taken while gameplay is writing may contain a torn record
+    static AZStd::array<TraceRecord, TraceRecordCount> s_traceRecords;
+    static AZStd::atomic<uint64_t> s_traceRecordsWritten{ 0 };
+
+    void GameplayTrace::Write(TraceEvent event, Multiplayer::NetEntityId netEntityId, const uint32_t* payload, uint16_t payloadWordCount)
+    {
+        const uint64_t recordIndex = s_traceRecordsWritten.fetch_add(1, AZStd::memory_order_relaxed);
+        TraceRecord& record = s_traceRecords[recordIndex % TraceRecordCount];
+
+        const auto now = AZStd::chrono::steady_clock::now().time_since_epoch();
+        record.m_timeUs = static_cast<uint64_t>(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now).count());
+        record.m_netEntityId = static_cast<uint64_t>(netEntityId);
+
+        const Multiplayer::INetworkTime* networkTime = Multiplayer::GetNetworkTime();
+        record.m_hostFrameId = networkTime ? static_cast<uint32_t>(networkTime->GetHostFrameId()) : 0;
+
+        record.m_event = event;
+        record.m_payloadWordCount = payloadWordCount;
+        for (uint16_t wordIndex = 0; wordIndex < payloadWordCount; ++wordIndex)
+        {
+            record.m_payload[wordIndex] = payload[wordIndex];
+        }
+    }
+
+    //! Writes the trace ring, oldest record first, preceded by a header and the event descriptors.
+    static void DumpGameplayTrace([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZ::IO::FixedMaxPath tracePath;
+        const AZ::CVarFixedString traceFile = mps_traceFile;
+        if (!AZ::IO::FileIOBase::GetInstance() || !AZ::IO::FileIOBase::GetInstance()->ResolvePath(tracePath, traceFile.c_str()))
+        {
+            tracePath = traceFile.c_str();
+        }
+
+        AZ::IO::SystemFileStream traceStream;
+        constexpr AZ::IO::OpenMode openMode = AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary | AZ::IO::OpenMode::ModeCreatePath;
+        if (!traceStream.Open(tracePath.c_str(), openMode))
+        {
+            AZLOG_WARN("Failed to open %s, the gameplay trace was not written", tracePath.c_str());
+            return;
+        }
+
+        const uint64_t recordsWritten = s_traceRecordsWritten.load(AZStd::memory_order_acquire);
+        const uint32_t recordCount = static_cast<uint32_t>(AZStd::min<uint64_t>(recordsWritten, TraceRecordCount));
+        const uint32_t recordSize = sizeof(TraceRecord);
+        const uint32_t eventCount = static_cast<uint32_t>(TraceEvent::Count);
+        const uint32_t traceLevel = MPS_TRACE_LEVEL;
+
+        traceStream.Write(sizeof(TraceFileMagic), TraceFileMagic);
+        traceStream.Write(sizeof(TraceFileVersion), &TraceFileVersion);
+        traceStream.Write(sizeof(traceLevel), &traceLevel);
+        traceStream.Write(sizeof(recordSize), &recordSize);
+        traceStream.Write(sizeof(eventCount), &eventCount);
+        traceStream.Write(sizeof(recordCount), &recordCount);
+
+        // Null terminated name and payload layout for every event
+        for (const TraceEventDescriptor& descriptor : TraceEventDescriptors)
+        {
+            traceStream.Write(strlen(descriptor.m_name) + 1, descriptor.m_name);
+            traceStream.Write(strlen(descriptor.m_payload) + 1, descriptor.m_payload);
+        }
+
+        for (uint64_t recordIndex = recordsWritten - recordCount; recordIndex < recordsWritten; ++recordIndex)
+        {
+            traceStream.Write(sizeof(TraceRecord), &s_traceRecords[recordIndex % TraceRecordCount]);
+        }
+
+        AZLOG_INFO("Wrote %u gameplay trace records to %s", recordCount, tracePath.c_str());
+    }
+    AZ_CONSOLEFREEFUNC(DumpGameplayTrace, AZ::ConsoleFunctorFlags::DontReplicate, "Writes the gameplay trace ring to mps_traceFile");
+#else
+    void GameplayTrace::Write(
+        [[maybe_unused]] TraceEvent event,
+        [[maybe_unused]] Multiplayer::NetEntityId netEntityId,
+        [[maybe_unused]] const uint32_t* payload,
+        [[maybe_unused]] uint16_t payloadWordCount)
+    {
+    }
+#endif
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <cstring>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/typetraits/is_enum.h>
+#include <AzCore/std/typetraits/is_floating_point.h>
+#include <AzCore/std/typetraits/is_same.h>
+#include <AzCore/std/typetraits/underlying_type.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+// Set through LY_MPS_TRACE_LEVEL, see TraceLevel
+#if !defined(MPS_TRACE_LEVEL)
+#   define MPS_TRACE_LEVEL 2
+#endif
+
+namespace MultiplayerSample
+{
+    //! Compile time verbosity of the gameplay trace. Records above MPS_TRACE_LEVEL, and their arguments, are compiled out.
+    enum class TraceLevel : uint8_t
+    {
+        Off = 0,
+        Event = 1,   //!< Rare gameplay events, such as rejected weapon activations
+        Detail = 2,  //!< Per weapon activation and hit
+        Verbose = 3  //!< Per input, such as every processed movement input
+    };
+
+    //! Gameplay trace events. Each event has a fixed payload layout, see TraceEventDescriptors in GameplayTrace.cpp.
+    enum class TraceEvent : uint16_t
+    {
+        WeaponStartFire,
+        WeaponStartFireRejected,
+        WeaponActivateRejected,
+        WeaponPredictedActivation,
+        WeaponSimulatedActivation,
+        WeaponPredictedHit,
+        WeaponConfirmedHit,
+        MovementInput,
+        Count
+    };
+
+    //! A single fixed size binary trace record.
+    struct TraceRecord
+    {
+        static constexpr uint32_t MaxPayloadWords = 6;
+
+        uint64_t m_timeUs = 0;
+        uint64_t m_netEntityId = 0;
+        uint32_t m_hostFrameId = 0;
+        TraceEvent m_event = TraceEvent::Count;
+        uint16_t m_payloadWordCount = 0;
+        AZStd::array<uint32_t, MaxPayloadWords> m_payload = {};
+    };
+    static_assert(sizeof(TraceRecord) == 48, "The trace dump format and scripts/decode_gameplay_trace.py assume 48 byte records");
+
+    namespace GameplayTrace
+    {
+        //! Appends a record to the trace ring, overwriting the oldest record once it is full.
+        void Write(TraceEvent event, Multiplayer::NetEntityId netEntityId, const uint32_t* payload, uint16_t payloadWordCount);
+
+        //! Number of payload words an argument takes, 64 bit values such as NetEntityId take two.
+        template<typename T>
+        constexpr uint16_t PayloadWordCount = (sizeof(T) > sizeof(uint32_t)) ? 2 : 1;
+
+        //! Appends an argument to the payload. 64 bit values are split into two words, low word first, so they aren't truncated.
+        template<typename T>
+        void AppendPayloadWords(uint32_t*& words, T value)
+        {
+            if constexpr (AZStd::is_same_v<T, float>)
+            {
+                memcpy(words++, &value, sizeof(uint32_t));
+            }
+            else if constexpr (AZStd::is_enum_v<T>)
+            {
+                AppendPayloadWords(words, static_cast<AZStd::underlying_type_t<T>>(value));
+            }
+            else if constexpr (PayloadWordCount<T> == 2)
+            {
+                static_assert(!AZStd::is_floating_point_v<T> && (sizeof(T) == sizeof(uint64_t)), "Only 64 bit integers take two payload words");
+                const uint64_t wideValue = static_cast<uint64_t>(value);
+                *words++ = static_cast<uint32_t>(wideValue);
+                *words++ = static_cast<uint32_t>(wideValue >> 32);
+            }
+            else
+            {
+                *words++ = static_cast<uint32_t>(value);
+            }
+        }
+
+        template<typename... Args>
+        void Record(TraceEvent event, Multiplayer::NetEntityId netEntityId, Args... args)
+        {
+            constexpr uint16_t payloadWordCount = (uint16_t{ 0 } + ... + PayloadWordCount<Args>);
+            static_assert(payloadWordCount <= TraceRecord::MaxPayloadWords, "Trace records hold at most TraceRecord::MaxPayloadWords payload words");
+            uint32_t payload[payloadWordCount + 1] = {};
+            uint32_t* words = payload;
+            (AppendPayloadWords(words, args), ...);
+            Write(event, netEntityId, payload, payloadWordCount);
+        }
+    }
+}
+
+//! Records a gameplay trace event when LEVEL is at or below MPS_TRACE_LEVEL, and compiles to nothing otherwise.
+//! Payload arguments are stored as raw 32 bit words, two for 64 bit values, and only formatted when a dump is decoded offline.
+//! @param LEVEL         a TraceLevel enumerator name
+//! @param EVENT         a TraceEvent enumerator name
+//! @param NET_ENTITY_ID the entity the event is about
+#define MPS_TRACE(LEVEL, EVENT, NET_ENTITY_ID, ...)                                                                             \
+    do                                                                                                                          \
+    {                                                                                                                           \
+        if constexpr (static_cast<int>(MultiplayerSample::TraceLevel::LEVEL) <= MPS_TRACE_LEVEL)                                \
+        {                                                                                                                       \
+            MultiplayerSample::GameplayTrace::Record(MultiplayerSample::TraceEvent::EVENT, NET_ENTITY_ID, ##__VA_ARGS__);       \
+        }                                                                                                                       \
+    } while (false)
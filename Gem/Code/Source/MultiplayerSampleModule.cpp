@@ -10,6 +10,7 @@
 #include <Components/AttachPlayerWeaponComponent.h>
 #include <Components/ExampleFilteredEntityComponent.h>
 #include <Components/PerfTest/NetworkPrefabSpawnerComponent.h>
+#include <Components/QuantizedTransformBoundsComponent.h>
 #include <Components/UI/UiCoinCountComponent.h>
 #include <Components/UI/UiGameOverComponent.h>
 #include <Components/UI/UiPlayerArmorComponent.h>
@@ -45,6 +46,7 @@ namespace MultiplayerSample
                 AttachPlayerWeaponComponent::CreateDescriptor(),
                 ExampleFilteredEntityComponent::CreateDescriptor(),
                 NetworkPrefabSpawnerComponent::CreateDescriptor(),
+                QuantizedTransformBoundsComponent::CreateDescriptor(),
                 UiCoinCountComponent::CreateDescriptor(),
                 BackgroundMusicComponent::CreateDescriptor(),
                 ScriptableDecalComponent::CreateDescriptor(),
@@ -105,6 +105,21 @@ namespace MultiplayerSample
         //! Register our gems multiplayer components to assign NetComponentIds
         RegisterMultiplayerComponents();
 
+        m_networkRandomTranslateSystem.Activate();
+
+#if AZ_TRAIT_SERVER
+        m_networkAiSystem.Activate();
+        m_perfTestSpatialHash.Activate();
+        m_weaponHitAggregator.Activate();
+        m_weaponProfiler.Activate();
+        m_serverInputRecorder.Activate();
+        m_serverInputReplayer.Activate();
+#endif
+
+#if AZ_TRAIT_CLIENT
+        m_weaponCatchUpBudget.Activate();
+#endif
+
         // Tell the user settings that this is the correct point in the boot process to apply the MSAA setting.
         MultiplayerSampleUserSettingsRequestBus::Broadcast(
             &MultiplayerSampleUserSettingsRequestBus::Events::ApplyMsaaSetting);
@@ -112,6 +127,20 @@ namespace MultiplayerSample
 
     void MultiplayerSampleSystemComponent::Deactivate()
     {
+#if AZ_TRAIT_CLIENT
+        m_weaponCatchUpBudget.Deactivate();
+#endif
+
+#if AZ_TRAIT_SERVER
+        m_serverInputReplayer.Deactivate();
+        m_serverInputRecorder.Deactivate();
+        m_weaponProfiler.Deactivate();
+        m_weaponHitAggregator.Deactivate();
+        m_perfTestSpatialHash.Deactivate();
+        m_networkAiSystem.Deactivate();
+#endif
+
+        m_networkRandomTranslateSystem.Deactivate();
     }
 
     AZ::Uuid MultiplayerSampleSystemComponent::GetRenderSceneIdByName(const AZStd::string& name)
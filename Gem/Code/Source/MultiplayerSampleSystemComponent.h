@@ -8,6 +8,14 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <Source/Components/NetworkAiSystem.h>
+#include <Source/Components/PerfTest/NetworkRandomTranslateSystem.h>
+#include <Source/Components/PerfTest/PerfTestSpatialHash.h>
+#include <Source/Weapons/WeaponCatchUpBudget.h>
+#include <Source/Weapons/WeaponHitAggregator.h>
+#include <Source/Weapons/WeaponProfiler.h>
+#include <Source/Replay/ServerInputRecorder.h>
+#include <Source/Replay/ServerInputReplayer.h>
 
 namespace MultiplayerSample
 {
@@ -32,5 +40,20 @@ namespace MultiplayerSample
         ////////////////////////////////////////////////////////////////////////
 
         static AZ::Uuid GetRenderSceneIdByName(const AZStd::string& name);
+
+        NetworkRandomTranslateSystem m_networkRandomTranslateSystem;
+
+#if AZ_TRAIT_SERVER
+        NetworkAiSystem m_networkAiSystem;
+        PerfTestSpatialHash m_perfTestSpatialHash;
+        WeaponHitAggregator m_weaponHitAggregator;
+        WeaponProfiler m_weaponProfiler;
+        ServerInputRecorder m_serverInputRecorder;
+        ServerInputReplayer m_serverInputReplayer;
+#endif
+
+#if AZ_TRAIT_CLIENT
+        WeaponCatchUpBudget m_weaponCatchUpBudget;
+#endif
     };
 }
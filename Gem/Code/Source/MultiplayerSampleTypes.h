@@ -20,10 +20,47 @@ namespace MultiplayerSample
     constexpr AZStd::string_view EnergyBallSpeedSetting = "/MultiplayerSample/Settings/EnergyBall/Speed";
     constexpr AZStd::string_view EnergyBallArmorDamageSetting = "/MultiplayerSample/Settings/EnergyBall/ArmorDamage";
     constexpr AZStd::string_view EnergyCannonFiringPeriodSetting = "/MultiplayerSample/Settings/EnergyCannon/FiringPeriodMilliseconds";
+    constexpr AZStd::string_view RelevancyTiersEnabledSetting = "/MultiplayerSample/Settings/RelevancyTiers/Enabled";
+    constexpr AZStd::string_view RelevancyNearDistanceSetting = "/MultiplayerSample/Settings/RelevancyTiers/NearDistanceMeters";
+    constexpr AZStd::string_view RelevancyMidDistanceSetting = "/MultiplayerSample/Settings/RelevancyTiers/MidDistanceMeters";
+    constexpr AZStd::string_view RelevancyHysteresisSetting = "/MultiplayerSample/Settings/RelevancyTiers/HysteresisMeters";
+    constexpr AZStd::string_view RelevancyMidUpdateIntervalSetting = "/MultiplayerSample/Settings/RelevancyTiers/MidUpdateIntervalMilliseconds";
+    constexpr AZStd::string_view RelevancyFarUpdateIntervalSetting = "/MultiplayerSample/Settings/RelevancyTiers/FarUpdateIntervalMilliseconds";
+    constexpr AZStd::string_view PerfTestSpatialHashEnabledSetting = "/MultiplayerSample/Settings/PerfTestSpatialHash/Enabled";
+    constexpr AZStd::string_view PerfTestSpatialHashCellSizeSetting = "/MultiplayerSample/Settings/PerfTestSpatialHash/CellSizeMeters";
+    constexpr AZStd::string_view PerfTestSpatialHashRelevancyCellsSetting = "/MultiplayerSample/Settings/PerfTestSpatialHash/RelevancyCells";
 
     using StickAxis = AzNetworking::QuantizedValues<1, 1, -1, 1>;
     using MouseAxis = AzNetworking::QuantizedValues<1, 2, -1, 1>;
 
+    //! A position normalized to [0, 1] on each axis of the level's quantization bounds, 16 bits per axis.
+    using QuantizedPosition = AzNetworking::QuantizedValues<3, 2, 0, 1>;
+
+    //! Smallest three encoding of a unit quaternion.
+    //! The largest component is dropped and rebuilt from the other three, which always lie in [-1/sqrt(2), 1/sqrt(2)],
+    //! so they are scaled by sqrt(2) before being quantized to 16 bits each.
+    struct QuantizedRotation
+    {
+        AzNetworking::QuantizedValues<3, 2, -1, 1> m_smallestThree;
+        uint8_t m_largestIndex = 3;
+
+        friend bool operator==(const QuantizedRotation& lhs, const QuantizedRotation& rhs)
+        {
+            return lhs.m_largestIndex == rhs.m_largestIndex
+                && lhs.m_smallestThree == rhs.m_smallestThree;
+        }
+
+        friend bool operator!=(const QuantizedRotation& lhs, const QuantizedRotation& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        bool Serialize(AzNetworking::ISerializer& serializer)
+        {
+            return serializer.Serialize(m_smallestThree, "SmallestThree") && serializer.Serialize(m_largestIndex, "LargestIndex");
+        }
+    };
+
     //! Various character animation states.
     enum class CharacterAnimState
     {
@@ -98,7 +135,14 @@ namespace MultiplayerSample
 
     using RoundTimeSec = AzNetworking::QuantizedValues<1, 2, 0, 3600>; // 1 hour max round duration
 
+    // Player capacity of a match. Sizes the replicated per-player arrays and the UI scoreboard storage.
+    // Set with the LY_MPS_MAX_SUPPORTED_PLAYERS CMake cache variable; arrays replicate per slot, so unused or unchanged slots cost no bandwidth.
+#if defined(MPS_MAX_SUPPORTED_PLAYERS)
+    static constexpr int MaxSupportedPlayers = MPS_MAX_SUPPORTED_PLAYERS;
+#else
     static constexpr int MaxSupportedPlayers = 10;
+#endif
+    static_assert(MaxSupportedPlayers > 0 && MaxSupportedPlayers <= 256, "MaxSupportedPlayers must be between 1 and 256");
 
     // Temporary match player state.
     struct PlayerCoinState
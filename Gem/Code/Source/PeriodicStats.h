@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Time/ITime.h>
+
+namespace MultiplayerSample
+{
+    //! Paces stats that are accumulated every update and logged every few seconds.
+    class PeriodicStats
+    {
+    public:
+        //! Returns true once intervalMs has passed since the last report, and starts the next interval.
+        //! The first call only starts the first interval.
+        bool ShouldReport(AZ::TimeMs intervalMs)
+        {
+            const AZ::TimeMs currentTime = AZ::GetElapsedTimeMs();
+            if (m_lastReportTime == AZ::Time::ZeroTimeMs)
+            {
+                m_lastReportTime = currentTime;
+                return false;
+            }
+
+            if (currentTime - m_lastReportTime < intervalMs)
+            {
+                return false;
+            }
+
+            m_lastReportTime = currentTime;
+            return true;
+        }
+
+    private:
+        AZ::TimeMs m_lastReportTime = AZ::Time::ZeroTimeMs;
+    };
+}
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Replay/ServerInputRecorder.h>
+#include <Source/Components/NetworkRandomComponent.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/containers/array.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/NetworkInput/NetworkInput.h>
+
+namespace MultiplayerSample
+{
+#if AZ_TRAIT_SERVER
+    AZ_CVAR(bool, sv_recordServerInputs, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the server starts recording processed inputs to sv_serverRecordingFile on startup");
+    AZ_CVAR(AZ::CVarFixedString, sv_serverRecordingFile, "@user@/server_inputs.mpsrec", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The file server inputs are recorded to, replay it with ReplayServerRecording");
+
+    void ServerInputRecorder::Activate()
+    {
+        AZ::Interface<ServerInputRecorder>::Register(this);
+        AzFramework::RootSpawnableNotificationBus::Handler::BusConnect();
+
+        if (sv_recordServerInputs)
+        {
+            const AZ::CVarFixedString recordingFile = sv_serverRecordingFile;
+            StartRecording(recordingFile.c_str());
+        }
+    }
+
+    void ServerInputRecorder::Deactivate()
+    {
+        StopRecording();
+        AzFramework::RootSpawnableNotificationBus::Handler::BusDisconnect();
+        AZ::Interface<ServerInputRecorder>::Unregister(this);
+    }
+
+    bool ServerInputRecorder::StartRecording(const char* recordingFile)
+    {
+        StopRecording();
+
+        AZ::IO::FixedMaxPath recordingPath;
+        if (!AZ::IO::FileIOBase::GetInstance() || !AZ::IO::FileIOBase::GetInstance()->ResolvePath(recordingPath, recordingFile))
+        {
+            recordingPath = recordingFile;
+        }
+
+        constexpr AZ::IO::OpenMode openMode = AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary | AZ::IO::OpenMode::ModeCreatePath;
+        if (!m_recordingStream.Open(recordingPath.c_str(), openMode))
+        {
+            AZLOG_WARN("Failed to open %s, server inputs will not be recorded", recordingPath.c_str());
+            return false;
+        }
+
+        m_recordingStream.Write(sizeof(ServerRecordingMagic), ServerRecordingMagic);
+        m_recordingStream.Write(sizeof(ServerRecordingVersion), &ServerRecordingVersion);
+
+        m_recordingTick = 0;
+        m_recordedInputCount = 0;
+        m_lastRecordedInputs.clear();
+        RecordLevel();
+        RecordActiveSeeds();
+
+        m_flushEvent.Enqueue(AZ::Time::ZeroTimeMs, true);
+        AZLOG_INFO("Recording server inputs to %s", recordingPath.c_str());
+        return true;
+    }
+
+    void ServerInputRecorder::StopRecording()
+    {
+        if (!m_recordingStream.IsOpen())
+        {
+            return;
+        }
+
+        m_flushEvent.RemoveFromQueue();
+        FlushPendingRecords();
+        m_recordingStream.Close();
+        m_lastRecordedInputs.clear();
+
+        AZLOG_INFO("Stopped recording server inputs, recorded %llu inputs over %u ticks",
+            static_cast<unsigned long long>(m_recordedInputCount), m_recordingTick);
+    }
+
+    bool ServerInputRecorder::IsRecording() const
+    {
+        return m_recordingStream.IsOpen();
+    }
+
+    void ServerInputRecorder::RecordSeed(Multiplayer::NetEntityId netEntityId, uint64_t seed)
+    {
+        if (!IsRecording())
+        {
+            return;
+        }
+
+        // Entities spawned later (players, gems, energy balls) get different NetEntityIds in a replay, so only level entities are matched by id
+        Append(ServerRecordType::Seed);
+        Append(static_cast<uint64_t>(netEntityId));
+        Append(seed);
+        Append(static_cast<uint8_t>(m_levelLoading ? 1 : 0));
+    }
+
+    void ServerInputRecorder::RecordInput(Multiplayer::NetEntityId netEntityId, Multiplayer::NetworkInput& input, float deltaTime)
+    {
+        if (!IsRecording())
+        {
+            return;
+        }
+
+        auto lastRecordedInput = m_lastRecordedInputs.find(netEntityId);
+        if (lastRecordedInput == m_lastRecordedInputs.end())
+        {
+            RecordSpawn(netEntityId);
+        }
+        else if (lastRecordedInput->second == input.GetClientInputId())
+        {
+            return;
+        }
+        m_lastRecordedInputs[netEntityId] = input.GetClientInputId();
+
+        AZStd::array<uint8_t, MaxRecordedInputSize> inputBuffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(inputBuffer.data(), static_cast<uint32_t>(inputBuffer.size()));
+        if (!input.Serialize(inputSerializer))
+        {
+            AZLOG_WARN("Input for entity %llu exceeds %u bytes and was not recorded",
+                static_cast<unsigned long long>(netEntityId), MaxRecordedInputSize);
+            return;
+        }
+
+        Append(ServerRecordType::Input);
+        Append(m_recordingTick);
+        Append(static_cast<uint64_t>(netEntityId));
+        Append(deltaTime);
+        Append(static_cast<uint16_t>(inputSerializer.GetSize()));
+        AppendBytes(inputBuffer.data(), inputSerializer.GetSize());
+        ++m_recordedInputCount;
+    }
+
+    void ServerInputRecorder::OnRootSpawnableAssigned(AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, [[maybe_unused]] uint32_t generation)
+    {
+        m_levelName = rootSpawnable.GetHint();
+        m_levelLoading = true;
+        if (IsRecording())
+        {
+            RecordLevel();
+        }
+    }
+
+    void ServerInputRecorder::OnRootSpawnableReady(
+        [[maybe_unused]] AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, [[maybe_unused]] uint32_t generation)
+    {
+        m_levelLoading = false;
+    }
+
+    void ServerInputRecorder::OnRootSpawnableReleased([[maybe_unused]] uint32_t generation)
+    {
+        m_levelName.clear();
+        m_levelLoading = false;
+    }
+
+    void ServerInputRecorder::RecordLevel()
+    {
+        if (m_levelName.empty())
+        {
+            return;
+        }
+
+        Append(ServerRecordType::Level);
+        Append(static_cast<uint16_t>(m_levelName.size()));
+        AppendBytes(m_levelName.data(), m_levelName.size());
+    }
+
+    void ServerInputRecorder::RecordActiveSeeds()
+    {
+        Multiplayer::IMultiplayer* multiplayer = AZ::Interface<Multiplayer::IMultiplayer>::Get();
+        if (!multiplayer)
+        {
+            return;
+        }
+
+        // Entities activated after this point record their own seeds from NetworkRandomComponentController::OnActivate()
+        for (auto& [netEntityId, entity] : *multiplayer->GetNetworkEntityManager()->GetNetworkEntityTracker())
+        {
+            if (const NetworkRandomComponent* randomComponent = entity->FindComponent<NetworkRandomComponent>())
+            {
+                RecordSeed(netEntityId, randomComponent->GetSeed());
+            }
+        }
+    }
+
+    void ServerInputRecorder::RecordSpawn(Multiplayer::NetEntityId netEntityId)
+    {
+        AZ::Transform worldTransform = AZ::Transform::CreateIdentity();
+        Multiplayer::ConstNetworkEntityHandle entityHandle =
+            AZ::Interface<Multiplayer::IMultiplayer>::Get()->GetNetworkEntityManager()->GetEntity(netEntityId);
+        if (const AZ::Entity* entity = entityHandle.GetEntity())
+        {
+            worldTransform = entity->GetTransform()->GetWorldTM();
+        }
+
+        const AZ::Vector3 translation = worldTransform.GetTranslation();
+        const AZ::Quaternion rotation = worldTransform.GetRotation();
+        Append(ServerRecordType::Spawn);
+        Append(static_cast<uint64_t>(netEntityId));
+        Append(static_cast<float>(translation.GetX()));
+        Append(static_cast<float>(translation.GetY()));
+        Append(static_cast<float>(translation.GetZ()));
+        Append(static_cast<float>(rotation.GetX()));
+        Append(static_cast<float>(rotation.GetY()));
+        Append(static_cast<float>(rotation.GetZ()));
+        Append(static_cast<float>(rotation.GetW()));
+    }
+
+    void ServerInputRecorder::FlushPendingRecords()
+    {
+        if (!m_pendingRecords.empty())
+        {
+            m_recordingStream.Write(m_pendingRecords.size(), m_pendingRecords.data());
+            m_pendingRecords.clear();
+        }
+        ++m_recordingTick;
+    }
+
+    void ServerInputRecorder::AppendBytes(const void* data, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        m_pendingRecords.insert(m_pendingRecords.end(), bytes, bytes + size);
+    }
+
+    void ServerInputRecorder::StartServerRecording(const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZ::CVarFixedString recordingFile = sv_serverRecordingFile;
+        if (!arguments.empty())
+        {
+            recordingFile = arguments.front();
+        }
+        StartRecording(recordingFile.c_str());
+    }
+
+    void ServerInputRecorder::StopServerRecording([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        StopRecording();
+    }
+#endif
+}
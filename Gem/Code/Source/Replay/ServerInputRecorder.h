@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Spawnable/RootSpawnableInterface.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer { class NetworkInput; }
+
+namespace MultiplayerSample
+{
+    //! A server input recording is ServerRecordingMagic and ServerRecordingVersion followed by records, each led by a ServerRecordType:
+    //!   Level: name length (u16), root spawnable path of the level, written whenever a level is loaded
+    //!   Seed:  NetEntityId (u64), seed (u64), level entity flag (u8), set for entities spawned while the level was loading
+    //!   Spawn: NetEntityId (u64), world translation (3 x f32), world rotation (4 x f32), written before an entity's first input
+    //!   Input: recording tick (u32), NetEntityId (u64), delta time (f32), input size (u16), serialized Multiplayer::NetworkInput
+    //! The recording tick counts server ticks since recording started, inputs sharing a tick are replayed in the same replay tick.
+    enum class ServerRecordType : uint8_t
+    {
+        Level,
+        Seed,
+        Spawn,
+        Input
+    };
+    constexpr char ServerRecordingMagic[8] = { 'M', 'P', 'S', 'I', 'N', 'P', 'U', 'T' };
+    constexpr uint32_t ServerRecordingVersion = 2;
+    constexpr uint32_t MaxRecordedInputSize = 1024;
+
+#if AZ_TRAIT_SERVER
+    //! Records every input the server processes for its player and AI entities, along with NetworkRandomComponent seeds,
+    //! so ServerInputReplayer can re-run the session offline.
+    //! Start it before the level loads (sv_recordServerInputs on the command line) to capture the seeds of every level entity.
+    class ServerInputRecorder
+        : public AzFramework::RootSpawnableNotificationBus::Handler
+    {
+    public:
+        AZ_RTTI(ServerInputRecorder, "{6C1E4F0B-93A2-4D7E-B5C8-2F9D0A7E14B3}");
+
+        ServerInputRecorder() = default;
+        virtual ~ServerInputRecorder() = default;
+
+        void Activate();
+        void Deactivate();
+
+        bool StartRecording(const char* recordingFile);
+        void StopRecording();
+        bool IsRecording() const;
+
+        //! Records the seed of an entity's NetworkRandomComponent.
+        void RecordSeed(Multiplayer::NetEntityId netEntityId, uint64_t seed);
+
+        //! Records an input the authority accepted, called by the movement controller once the input passed its reset count check.
+        //! Repeats of the entity's last recorded input are ignored.
+        void RecordInput(Multiplayer::NetEntityId netEntityId, Multiplayer::NetworkInput& input, float deltaTime);
+
+    private:
+        //! AzFramework::RootSpawnableNotificationBus overrides
+        //! @{
+        void OnRootSpawnableAssigned(AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, uint32_t generation) override;
+        void OnRootSpawnableReady(AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, uint32_t generation) override;
+        void OnRootSpawnableReleased(uint32_t generation) override;
+        //! @}
+
+        void RecordLevel();
+        void RecordActiveSeeds();
+        void RecordSpawn(Multiplayer::NetEntityId netEntityId);
+        void FlushPendingRecords();
+
+        void AppendBytes(const void* data, size_t size);
+        template<typename T>
+        void Append(const T& value)
+        {
+            AppendBytes(&value, sizeof(T));
+        }
+
+        void StartServerRecording(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(ServerInputRecorder, StartServerRecording, AZ::ConsoleFunctorFlags::DontReplicate, "Starts recording server inputs to the given file, or sv_serverRecordingFile");
+        void StopServerRecording(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(ServerInputRecorder, StopServerRecording, AZ::ConsoleFunctorFlags::DontReplicate, "Stops recording server inputs");
+
+        AZ::IO::SystemFileStream m_recordingStream;
+
+        // Records gathered during a tick are written to the file once per tick
+        AZStd::vector<uint8_t> m_pendingRecords;
+        AZStd::unordered_map<Multiplayer::NetEntityId, Multiplayer::ClientInputId> m_lastRecordedInputs;
+        AZStd::string m_levelName;
+        bool m_levelLoading = false;
+        uint32_t m_recordingTick = 0;
+        uint64_t m_recordedInputCount = 0;
+
+        AZ::ScheduledEvent m_flushEvent{ [this]()
+        {
+            FlushPendingRecords();
+        }, AZ::Name("ServerInputRecorderFlush") };
+    };
+#endif
+}
@@ -0,0 +1,452 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Replay/ServerInputReplayer.h>
+#include <Source/Replay/ServerInputRecorder.h>
+#include <Source/Components/NetworkPlayerMovementComponent.h>
+#include <Source/Components/NetworkRandomComponent.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/Components/NetworkTransformComponent.h>
+#include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
+#include <Multiplayer/NetworkInput/NetworkInput.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+
+namespace MultiplayerSample
+{
+#if AZ_TRAIT_SERVER
+    AZ_CVAR(bool, sv_replayExitOnEnd, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the server quits once a replay finishes");
+
+    static int64_t ToMicroseconds(AZStd::chrono::steady_clock::duration duration)
+    {
+        return static_cast<int64_t>(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(duration).count());
+    }
+
+    //! Bounds checked reads from a loaded recording.
+    class RecordingReader
+    {
+    public:
+        explicit RecordingReader(const AZStd::vector<uint8_t>& recording)
+            : m_recording(recording)
+        {
+        }
+
+        template<typename T>
+        bool Read(T& outValue)
+        {
+            if (m_offset + sizeof(T) > m_recording.size())
+            {
+                return false;
+            }
+            memcpy(&outValue, m_recording.data() + m_offset, sizeof(T));
+            m_offset += sizeof(T);
+            return true;
+        }
+
+        bool ReadString(AZStd::string& outString, size_t size)
+        {
+            if (m_offset + size > m_recording.size())
+            {
+                return false;
+            }
+            outString.assign(reinterpret_cast<const char*>(m_recording.data() + m_offset), size);
+            m_offset += size;
+            return true;
+        }
+
+        bool Skip(size_t size)
+        {
+            if (m_offset + size > m_recording.size())
+            {
+                return false;
+            }
+            m_offset += size;
+            return true;
+        }
+
+        bool IsAtEnd() const
+        {
+            return m_offset >= m_recording.size();
+        }
+
+        size_t GetOffset() const
+        {
+            return m_offset;
+        }
+
+    private:
+        const AZStd::vector<uint8_t>& m_recording;
+        size_t m_offset = 0;
+    };
+
+    void ServerInputReplayer::Activate()
+    {
+        AZ::Interface<ServerInputReplayer>::Register(this);
+        AzFramework::RootSpawnableNotificationBus::Handler::BusConnect();
+    }
+
+    void ServerInputReplayer::Deactivate()
+    {
+        AzFramework::RootSpawnableNotificationBus::Handler::BusDisconnect();
+        m_startOnLevelLoad = false;
+        m_startReplayEvent.RemoveFromQueue();
+        m_replayTickEvent.RemoveFromQueue();
+        m_puppets.clear();
+        AZ::Interface<ServerInputReplayer>::Unregister(this);
+    }
+
+    bool ServerInputReplayer::LoadRecording(const char* recordingFile)
+    {
+        m_startOnLevelLoad = false;
+        m_startReplayEvent.RemoveFromQueue();
+        m_replayTickEvent.RemoveFromQueue();
+
+        AZ::IO::FixedMaxPath recordingPath;
+        if (!AZ::IO::FileIOBase::GetInstance() || !AZ::IO::FileIOBase::GetInstance()->ResolvePath(recordingPath, recordingFile))
+        {
+            recordingPath = recordingFile;
+        }
+
+        AZ::IO::SystemFileStream recordingStream;
+        if (!recordingStream.Open(recordingPath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary))
+        {
+            AZLOG_WARN("Failed to open server recording %s", recordingPath.c_str());
+            return false;
+        }
+
+        AZStd::vector<uint8_t> recording(recordingStream.GetLength());
+        if (recordingStream.Read(recording.size(), recording.data()) != recording.size())
+        {
+            AZLOG_WARN("Failed to read server recording %s", recordingPath.c_str());
+            return false;
+        }
+
+        if (!ParseRecording(recording))
+        {
+            AZLOG_WARN("%s is not a valid server recording", recordingPath.c_str());
+            return false;
+        }
+
+        m_inputData = AZStd::move(recording);
+        AZLOG_INFO("Loaded %u inputs for %u entities from %s", static_cast<uint32_t>(m_inputs.size()),
+            static_cast<uint32_t>(m_spawnTransforms.size()), recordingPath.c_str());
+
+        if (!m_levelName.empty())
+        {
+            // Always reload, level entities only get their recorded NetEntityIds and seeds from a fresh load
+            AZLOG_INFO("Replay starts once %s has loaded", m_levelName.c_str());
+            m_startOnLevelLoad = true;
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand(AZStd::string::format("LoadLevel %s", m_levelName.c_str()).c_str());
+        }
+        else if (m_levelLoaded)
+        {
+            m_startReplayEvent.Enqueue(AZ::Time::ZeroTimeMs);
+        }
+        else
+        {
+            AZLOG_INFO("The recording has no level, replay starts once a level has loaded");
+            m_startOnLevelLoad = true;
+        }
+        return true;
+    }
+
+    void ServerInputReplayer::OnRootSpawnableAssigned(
+        [[maybe_unused]] AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, [[maybe_unused]] uint32_t generation)
+    {
+        m_levelLoading = true;
+    }
+
+    void ServerInputReplayer::OnRootSpawnableReady(
+        [[maybe_unused]] AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, [[maybe_unused]] uint32_t generation)
+    {
+        m_levelLoading = false;
+        m_levelLoaded = true;
+        if (m_startOnLevelLoad)
+        {
+            // Start on the next tick, once everything else has handled the level load
+            m_startOnLevelLoad = false;
+            m_startReplayEvent.Enqueue(AZ::Time::ZeroTimeMs);
+        }
+    }
+
+    void ServerInputReplayer::OnRootSpawnableReleased([[maybe_unused]] uint32_t generation)
+    {
+        m_levelLoading = false;
+        m_levelLoaded = false;
+    }
+
+    bool ServerInputReplayer::FindLevelEntitySeed(Multiplayer::NetEntityId netEntityId, uint64_t& outSeed) const
+    {
+        if (!m_levelLoading)
+        {
+            return false;
+        }
+
+        auto recordedSeed = m_levelEntitySeeds.find(netEntityId);
+        if (recordedSeed == m_levelEntitySeeds.end())
+        {
+            return false;
+        }
+        outSeed = recordedSeed->second;
+        return true;
+    }
+
+    bool ServerInputReplayer::ParseRecording(const AZStd::vector<uint8_t>& recording)
+    {
+        m_inputs.clear();
+        m_levelName.clear();
+        m_levelEntitySeeds.clear();
+        m_recordedSeeds.clear();
+        m_spawnTransforms.clear();
+
+        RecordingReader reader(recording);
+        char magic[sizeof(ServerRecordingMagic)];
+        uint32_t version = 0;
+        if (!reader.Read(magic) || (memcmp(magic, ServerRecordingMagic, sizeof(magic)) != 0) || !reader.Read(version))
+        {
+            return false;
+        }
+
+        if (version != ServerRecordingVersion)
+        {
+            AZLOG_WARN("Unsupported server recording version %u, expected %u", version, ServerRecordingVersion);
+            return false;
+        }
+
+        while (!reader.IsAtEnd())
+        {
+            ServerRecordType recordType;
+            uint64_t netEntityId = 0;
+            if (!reader.Read(recordType))
+            {
+                return false;
+            }
+
+            switch (recordType)
+            {
+            case ServerRecordType::Level:
+            {
+                uint16_t nameLength = 0;
+                if (!reader.Read(nameLength) || !reader.ReadString(m_levelName, nameLength))
+                {
+                    return false;
+                }
+                // A level loaded during the recording starts a new set of level entities
+                m_levelEntitySeeds.clear();
+                break;
+            }
+            case ServerRecordType::Seed:
+            {
+                uint64_t seed = 0;
+                uint8_t isLevelEntity = 0;
+                if (!reader.Read(netEntityId) || !reader.Read(seed) || !reader.Read(isLevelEntity))
+                {
+                    return false;
+                }
+                m_recordedSeeds[Multiplayer::NetEntityId{ netEntityId }] = seed;
+                if (isLevelEntity)
+                {
+                    m_levelEntitySeeds[Multiplayer::NetEntityId{ netEntityId }] = seed;
+                }
+                break;
+            }
+            case ServerRecordType::Spawn:
+            {
+                float values[7];
+                if (!reader.Read(netEntityId) || !reader.Read(values))
+                {
+                    return false;
+                }
+                m_spawnTransforms[Multiplayer::NetEntityId{ netEntityId }] = AZ::Transform::CreateFromQuaternionAndTranslation(
+                    AZ::Quaternion(values[3], values[4], values[5], values[6]), AZ::Vector3(values[0], values[1], values[2]));
+                break;
+            }
+            case ServerRecordType::Input:
+            {
+                RecordedInput recordedInput;
+                if (!reader.Read(recordedInput.m_recordingTick) || !reader.Read(netEntityId) ||
+                    !reader.Read(recordedInput.m_deltaTime) || !reader.Read(recordedInput.m_dataSize))
+                {
+                    return false;
+                }
+                recordedInput.m_netEntityId = Multiplayer::NetEntityId{ netEntityId };
+                recordedInput.m_dataOffset = static_cast<uint32_t>(reader.GetOffset());
+                if ((recordedInput.m_dataSize > MaxRecordedInputSize) || !reader.Skip(recordedInput.m_dataSize))
+                {
+                    return false;
+                }
+                m_inputs.push_back(recordedInput);
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void ServerInputReplayer::StartReplay()
+    {
+        m_puppets.clear();
+        m_stats = ReplayStats{};
+        m_nextInput = 0;
+        m_replayTick = m_inputs.empty() ? 0 : m_inputs.front().m_recordingTick;
+        m_replayTickEvent.Enqueue(AZ::Time::ZeroTimeMs, true);
+        AZLOG_INFO("Replaying %u recorded inputs", static_cast<uint32_t>(m_inputs.size()));
+    }
+
+    void ServerInputReplayer::ReplayTick()
+    {
+        if (m_nextInput >= m_inputs.size())
+        {
+            FinishReplay();
+            return;
+        }
+
+        const Multiplayer::INetworkTime* networkTime = Multiplayer::GetNetworkTime();
+        const auto startTime = AZStd::chrono::steady_clock::now();
+        for (; (m_nextInput < m_inputs.size()) && (m_inputs[m_nextInput].m_recordingTick <= m_replayTick); ++m_nextInput)
+        {
+            const RecordedInput& recordedInput = m_inputs[m_nextInput];
+            Multiplayer::NetworkEntityHandle puppet = GetOrSpawnPuppet(recordedInput.m_netEntityId);
+            Multiplayer::NetBindComponent* netBindComponent = puppet.GetNetBindComponent();
+            if (!netBindComponent)
+            {
+                ++m_stats.m_failedInputs;
+                continue;
+            }
+
+            Multiplayer::NetworkInput input;
+            input.AttachNetBindComponent(netBindComponent);
+            AzNetworking::NetworkOutputSerializer inputSerializer(m_inputData.data() + recordedInput.m_dataOffset, recordedInput.m_dataSize);
+            if (!input.Serialize(inputSerializer))
+            {
+                ++m_stats.m_failedInputs;
+                continue;
+            }
+
+            // The recorded host frame only exists in the recorded session, rewind against the replay's own history instead
+            input.SetHostFrameId(networkTime->GetHostFrameId());
+            input.SetHostTimeMs(networkTime->GetHostTimeMs());
+            RebaseResetCount(puppet, input);
+            netBindComponent->ProcessInput(input, recordedInput.m_deltaTime);
+            ++m_stats.m_inputs;
+        }
+
+        const auto tickTime = AZStd::chrono::steady_clock::now() - startTime;
+        m_stats.m_totalTime += tickTime;
+        if (tickTime > m_stats.m_peakTickTime)
+        {
+            m_stats.m_peakTickTime = tickTime;
+            m_stats.m_peakTick = m_replayTick;
+        }
+        ++m_stats.m_ticks;
+        ++m_replayTick;
+    }
+
+    void ServerInputReplayer::FinishReplay()
+    {
+        m_replayTickEvent.RemoveFromQueue();
+
+        const int64_t totalUs = ToMicroseconds(m_stats.m_totalTime);
+        AZLOG_INFO("Replay finished: %u ticks, %u inputs (%u failed, %u reset count rebases), %u puppets, input processing %lld us total, "
+            "%.3f us/tick, %lld us peak at recording tick %u",
+            m_stats.m_ticks, m_stats.m_inputs, m_stats.m_failedInputs, m_stats.m_resetCountRebases, static_cast<uint32_t>(m_puppets.size()),
+            static_cast<long long>(totalUs), static_cast<double>(totalUs) / AZStd::max(m_stats.m_ticks, 1u),
+            static_cast<long long>(ToMicroseconds(m_stats.m_peakTickTime)), m_stats.m_peakTick);
+
+        Multiplayer::INetworkEntityManager* networkEntityManager = AZ::Interface<Multiplayer::IMultiplayer>::Get()->GetNetworkEntityManager();
+        for (auto& [recordedNetEntityId, puppet] : m_puppets)
+        {
+            if (puppet.Exists())
+            {
+                networkEntityManager->MarkForRemoval(puppet);
+            }
+        }
+        m_puppets.clear();
+
+        if (sv_replayExitOnEnd)
+        {
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("quit");
+        }
+    }
+
+    Multiplayer::NetworkEntityHandle ServerInputReplayer::GetOrSpawnPuppet(Multiplayer::NetEntityId recordedNetEntityId)
+    {
+        auto puppet = m_puppets.find(recordedNetEntityId);
+        if (puppet != m_puppets.end())
+        {
+            return puppet->second;
+        }
+
+        static Multiplayer::PrefabEntityId prefabId(AZ::Name{ "prefabs/player.network.spawnable" });
+
+        auto spawnTransform = m_spawnTransforms.find(recordedNetEntityId);
+        const AZ::Transform transform = (spawnTransform != m_spawnTransforms.end()) ? spawnTransform->second : AZ::Transform::CreateIdentity();
+
+        Multiplayer::INetworkEntityManager::EntityList entityList =
+            AZ::Interface<Multiplayer::IMultiplayer>::Get()->GetNetworkEntityManager()->CreateEntitiesImmediate(
+                prefabId, Multiplayer::NetEntityRole::Authority, transform, Multiplayer::AutoActivate::DoNotActivate);
+
+        Multiplayer::NetworkEntityHandle createdEntity;
+        if (entityList.empty())
+        {
+            AZ_Error("ServerInputReplayer", false, "Failed to spawn a puppet for recorded entity %llu",
+                static_cast<unsigned long long>(recordedNetEntityId));
+        }
+        else
+        {
+            // Recorded AI inputs are replayed as-is, the puppet doesn't think for itself
+            createdEntity = entityList[0];
+            createdEntity.Activate();
+
+            NetworkRandomComponentController* randomController = createdEntity.FindController<NetworkRandomComponentController>();
+            auto recordedSeed = m_recordedSeeds.find(recordedNetEntityId);
+            if (randomController && (recordedSeed != m_recordedSeeds.end()))
+            {
+                randomController->SetSeed(recordedSeed->second);
+            }
+        }
+
+        // Remember failed spawns too, so a missing prefab reports once rather than for every input
+        m_puppets[recordedNetEntityId] = createdEntity;
+        return createdEntity;
+    }
+
+    void ServerInputReplayer::RebaseResetCount(Multiplayer::NetworkEntityHandle& puppet, Multiplayer::NetworkInput& input)
+    {
+        const NetworkPlayerMovementComponentNetworkInput* movementInput = input.FindComponentInput<NetworkPlayerMovementComponentNetworkInput>();
+        Multiplayer::NetworkTransformComponentController* transformController = puppet.FindController<Multiplayer::NetworkTransformComponentController>();
+        if (movementInput && transformController && (movementInput->m_resetCount != transformController->GetResetCount()))
+        {
+            transformController->SetResetCount(movementInput->m_resetCount);
+            ++m_stats.m_resetCountRebases;
+        }
+    }
+
+    void ServerInputReplayer::ReplayServerRecording(const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZ::CVarFixedString recordingFile;
+        if (!arguments.empty())
+        {
+            recordingFile = arguments.front();
+        }
+        else
+        {
+            AZ::Interface<AZ::IConsole>::Get()->GetCvarValue("sv_serverRecordingFile", recordingFile);
+        }
+
+        LoadRecording(recordingFile.c_str());
+    }
+#endif
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Spawnable/RootSpawnableInterface.h>
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+
+namespace Multiplayer { class NetworkInput; }
+
+namespace MultiplayerSample
+{
+#if AZ_TRAIT_SERVER
+    //! Replays a recording made by ServerInputRecorder on a server without any connected players.
+    //! Every recorded player or AI entity is driven by a puppet spawned from the player prefab, which processes the
+    //! recorded inputs tick for tick. The replay reloads the recorded level, whose entities keep their recorded NetworkRandomComponent
+    //! seeds, so a replay makes the same gameplay decisions on every run and can be profiled headless (see launch_replay_server.sh).
+    //! Entities spawned during the session, other than the puppets, get fresh seeds since their NetEntityIds differ from the recording.
+    class ServerInputReplayer
+        : public AzFramework::RootSpawnableNotificationBus::Handler
+    {
+    public:
+        AZ_RTTI(ServerInputReplayer, "{A8D35E71-0C4B-4F26-8E9A-3B7F51D2C6E0}");
+
+        ServerInputReplayer() = default;
+        virtual ~ServerInputReplayer() = default;
+
+        void Activate();
+        void Deactivate();
+
+        //! Loads a recording and the level it was recorded on, and starts replaying once that level has loaded.
+        //! Recordings without a level start once a level has loaded, or on the next tick if one already has.
+        bool LoadRecording(const char* recordingFile);
+
+        //! Returns the seed recorded for a level entity. Only answers while the level is loading, so entities spawned
+        //! afterwards never pick up the seed of a recorded entity that happened to have the same NetEntityId.
+        bool FindLevelEntitySeed(Multiplayer::NetEntityId netEntityId, uint64_t& outSeed) const;
+
+    private:
+        //! AzFramework::RootSpawnableNotificationBus overrides
+        //! @{
+        void OnRootSpawnableAssigned(AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, uint32_t generation) override;
+        void OnRootSpawnableReady(AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, uint32_t generation) override;
+        void OnRootSpawnableReleased(uint32_t generation) override;
+        //! @}
+
+        struct RecordedInput
+        {
+            uint32_t m_recordingTick = 0;
+            Multiplayer::NetEntityId m_netEntityId = Multiplayer::InvalidNetEntityId;
+            float m_deltaTime = 0.0f;
+            uint32_t m_dataOffset = 0;
+            uint16_t m_dataSize = 0;
+        };
+
+        bool ParseRecording(const AZStd::vector<uint8_t>& recording);
+        void StartReplay();
+        void ReplayTick();
+        void FinishReplay();
+        Multiplayer::NetworkEntityHandle GetOrSpawnPuppet(Multiplayer::NetEntityId recordedNetEntityId);
+
+        //! Moves the puppet to the reset count the recorded input was made with.
+        //! The recorder only sees inputs whose reset count matched, so a mismatch means the recorded entity was reset (for example teleported)
+        //! by something the replay didn't reproduce, and the input would otherwise be silently rejected.
+        void RebaseResetCount(Multiplayer::NetworkEntityHandle& puppet, Multiplayer::NetworkInput& input);
+
+        void ReplayServerRecording(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(ServerInputReplayer, ReplayServerRecording, AZ::ConsoleFunctorFlags::DontReplicate, "Replays a server input recording, defaults to sv_serverRecordingFile");
+
+        AZStd::vector<uint8_t> m_inputData;
+        AZStd::vector<RecordedInput> m_inputs;
+        AZStd::string m_levelName;
+        AZStd::unordered_map<Multiplayer::NetEntityId, uint64_t> m_levelEntitySeeds;
+        AZStd::unordered_map<Multiplayer::NetEntityId, uint64_t> m_recordedSeeds;  //!< Every recorded seed, puppets take the seed of the entity they replay
+        AZStd::unordered_map<Multiplayer::NetEntityId, AZ::Transform> m_spawnTransforms;
+        AZStd::unordered_map<Multiplayer::NetEntityId, Multiplayer::NetworkEntityHandle> m_puppets;
+        size_t m_nextInput = 0;
+        uint32_t m_replayTick = 0;
+        bool m_levelLoading = false;
+        bool m_levelLoaded = false;
+        bool m_startOnLevelLoad = false;
+
+        struct ReplayStats
+        {
+            uint32_t m_ticks = 0;
+            uint32_t m_inputs = 0;
+            uint32_t m_failedInputs = 0;
+            uint32_t m_resetCountRebases = 0;
+            AZStd::chrono::steady_clock::duration m_totalTime{};
+            AZStd::chrono::steady_clock::duration m_peakTickTime{};
+            uint32_t m_peakTick = 0;
+        };
+        ReplayStats m_stats;
+
+        AZ::ScheduledEvent m_startReplayEvent{ [this]()
+        {
+            StartReplay();
+        }, AZ::Name("ServerInputReplayerStart") };
+
+        AZ::ScheduledEvent m_replayTickEvent{ [this]()
+        {
+            ReplayTick();
+        }, AZ::Name("ServerInputReplayerTick") };
+    };
+#endif
+}
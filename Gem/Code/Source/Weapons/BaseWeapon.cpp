@@ -8,6 +8,8 @@
 #include <Source/Weapons/BaseWeapon.h>
 #include <Source/Weapons/TraceWeapon.h>
 #include <Source/Weapons/ProjectileWeapon.h>
+#include <Source/Weapons/WeaponProfiler.h>
+#include <Source/GameplayTrace.h>
 #include <AzCore/Console/ILogger.h>
 
 namespace MultiplayerSample
@@ -18,6 +20,7 @@ namespace MultiplayerSample
         : m_owningEntity(constructParams.m_owningEntity)
         , m_weaponIndex(constructParams.m_weaponIndex)
         , m_weaponParams(constructParams.m_weaponParams)
+        , m_damageFalloff(constructParams.m_weaponParams.m_damageEffect, constructParams.m_weaponParams.m_weaponMaxAimDistance)
         , m_weaponListener(constructParams.m_weaponListener)
     {
         m_activateEffect = constructParams.m_weaponParams.m_activateFx;
@@ -40,6 +43,11 @@ namespace MultiplayerSample
         return m_weaponParams;
     }
 
+    float BaseWeapon::GetHitDamage(float hitDistance) const
+    {
+        return m_damageFalloff.GetMagnitude(hitDistance);
+    }
+
     void BaseWeapon::UpdateWeaponState(WeaponState& weaponState, float deltaTime)
     {
         const float newCooldown = AZStd::max(0.0f, weaponState.m_cooldownTime - deltaTime);
@@ -61,7 +69,7 @@ namespace MultiplayerSample
     {
         if (!CanStartNextEvent(weaponState, WeaponStatus::Idle))
         {
-            AZLOG(NET_Weapons, "TryStartFire rejected; WeaponStatus is %s, cooldowntime is %f", GetEnumString(weaponState.m_status), weaponState.m_cooldownTime);
+            MPS_TRACE(Event, WeaponStartFireRejected, m_owningEntity.GetNetEntityId(), weaponState.m_status, weaponState.m_cooldownTime);
             return false;
         }
 
@@ -110,7 +118,7 @@ namespace MultiplayerSample
     {
         if (validateFiringState && !CanStartNextEvent(weaponState, WeaponStatus::Firing))
         {
-            AZLOG(NET_Weapons, "ActivateInternal rejected! WeaponStatus is %s, cooldowntime is %f", GetEnumString(weaponState.m_status), weaponState.m_cooldownTime);
+            MPS_TRACE(Event, WeaponActivateRejected, m_owningEntity.GetNetEntityId(), weaponState.m_status, weaponState.m_cooldownTime);
             return false;
         }
 
@@ -122,6 +130,7 @@ namespace MultiplayerSample
 
     bool BaseWeapon::GatherEntities(const ActivateEvent& eventData, IntersectResults& outResults)
     {
+        WeaponProfileScope profileScope(m_weaponParams.m_weaponType, WeaponProfileStage::GatherEntities);
         const bool result = MultiplayerSample::GatherEntities(m_weaponParams.m_gatherParams, eventData, m_gatheredNetEntityIds, outResults);
         if (gp_PauseOnWeaponGather && (outResults.size() > 0))
         {
@@ -132,6 +141,7 @@ namespace MultiplayerSample
 
     ShotResult BaseWeapon::GatherEntitiesMultisegment(float deltaTime, ActiveShot& inOutActiveShot, IntersectResults& outResults)
     {
+        WeaponProfileScope profileScope(m_weaponParams.m_weaponType, WeaponProfileStage::GatherEntities);
         ShotResult result = MultiplayerSample::GatherEntitiesMultisegment(m_weaponParams.m_gatherParams, m_gatheredNetEntityIds, deltaTime, inOutActiveShot, outResults);
         if (gp_PauseOnWeaponGather && (outResults.size() > 0))
         {
@@ -142,16 +152,21 @@ namespace MultiplayerSample
 
     void BaseWeapon::DispatchHitEvents(const IntersectResults& gatherResults, const ActivateEvent& eventData, const NetEntityIdSet& prefilteredNetEntityIds)
     {
-        HitEvent hitEvent
-        {
-            eventData.m_targetPosition,
-            eventData.m_shooterId,
-            Multiplayer::InvalidNetEntityId,
-            HitEntities()
-        };
+        // Reuse the weapon's hit event so dispatching a hit never allocates
+        HitEvent& hitEvent = m_hitEvent;
+        hitEvent.m_target = eventData.m_targetPosition;
+        hitEvent.m_shooterNetEntityId = eventData.m_shooterId;
+        hitEvent.m_projectileNetEntityId = Multiplayer::InvalidNetEntityId;
+        hitEvent.m_hitEntities.clear();
 
-        for (auto gatherResult : gatherResults)
+        for (const IntersectResult& gatherResult : gatherResults)
         {
+            if (hitEvent.m_hitEntities.size() >= hitEvent.m_hitEntities.capacity())
+            {
+                AZLOG_WARN("Weapon gathered more than %u entities in a single shot, dropping the remaining hits", MaxHitEntities);
+                break;
+            }
+
             if (prefilteredNetEntityIds.size() > 0)
             {
                 if (prefilteredNetEntityIds.find(gatherResult.m_netEntityId) != prefilteredNetEntityIds.end())
@@ -161,7 +176,8 @@ namespace MultiplayerSample
                 }
             }
 
-            hitEvent.m_hitEntities.emplace_back(HitEntity{ gatherResult.m_position, gatherResult.m_normal, gatherResult.m_netEntityId });
+            const float hitDistance = gatherResult.m_position.GetDistance(eventData.m_initialTransform.GetTranslation());
+            hitEvent.m_hitEntities.emplace_back(HitEntity{ gatherResult.m_position, gatherResult.m_normal, gatherResult.m_netEntityId, hitDistance });
         }
 
         WeaponHitInfo hitInfo(*this, hitEvent);
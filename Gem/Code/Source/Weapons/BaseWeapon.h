@@ -36,6 +36,7 @@ namespace MultiplayerSample
         //! @{
         WeaponIndex GetWeaponIndex() const override;
         const WeaponParams& GetParams() const override;
+        float GetHitDamage(float hitDistance) const override;
         void UpdateWeaponState(WeaponState& weaponState, float deltaTime) override;
         bool CanStartNextEvent(const WeaponState& weaponState, WeaponStatus requiredStatus) const override;
         bool TryStartFire(WeaponState& weaponState, const FireParams& fireParams) override;
@@ -75,6 +76,7 @@ namespace MultiplayerSample
         const Multiplayer::ConstNetworkEntityHandle m_owningEntity;
         const WeaponIndex  m_weaponIndex;
         const WeaponParams m_weaponParams;
+        const HitEffectFalloffTable m_damageFalloff; // m_weaponParams.m_damageEffect sampled out to m_weaponMaxAimDistance
 
         WeaponListener& m_weaponListener;
 
@@ -84,6 +86,10 @@ namespace MultiplayerSample
 
         FireParams m_fireParams;
         NetEntityIdSet m_gatheredNetEntityIds;
+
+        // Scratch buffers reused across shots so gathering and dispatching hits doesn't allocate once warmed up
+        IntersectResults m_gatherResults;
+        HitEvent m_hitEvent;
     };
 
     //! Factory function to create an appropriate IWeapon instance given the provided ConstructParams.
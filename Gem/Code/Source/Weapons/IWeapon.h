@@ -46,6 +46,11 @@ namespace MultiplayerSample
         //! @return the WeaponParams for the given IWeapon instance
         virtual const WeaponParams& GetParams() const = 0;
 
+        //! Returns the damage a hit deals at the given distance, using the weapon's precomputed damage falloff.
+        //! @param hitDistance the distance from the shot origin to the hit
+        //! @return the damage to apply
+        virtual float GetHitDamage(float hitDistance) const = 0;
+
         //! Update the weapon's internal state.
         //! @param weaponState the weapon state being updated
         //! @param deltaTime   the amount of time to update weapon state by
@@ -130,7 +135,7 @@ namespace MultiplayerSample
         WeaponHitInfo(const IWeapon& weapon, const HitEvent& hitEvent);
 
         const IWeapon& m_weapon; //< Reference to the weapon instance which produced the hit
-        HitEvent m_hitEvent;     //< Specific details about the weapon hit event
+        const HitEvent& m_hitEvent; //< Specific details about the weapon hit event, only valid while the hit is being dispatched
 
         WeaponHitInfo& operator =(const WeaponHitInfo&) = delete; // Don't allow copying, these guys get dispatched under special conditions
     };
@@ -6,6 +6,7 @@
  */
 
 #include <Source/Weapons/SceneQuery.h>
+#include <Source/Weapons/WeaponProfiler.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
 #include <AzFramework/Physics/PhysicsScene.h>
@@ -68,6 +69,8 @@ namespace MultiplayerSample
 
         size_t WorldIntersect(const GatherShape& intersectShape, const IntersectFilter& filter, IntersectResults& outResults)
         {
+            WeaponProfileScope profileScope(WeaponProfileStage::WorldIntersect);
+
             AZ_Assert(intersectShape == GatherShape::Point || filter.m_shapeConfiguration != nullptr,
                 "Shape configuration must be provided for shape casts and overlap requests");
 
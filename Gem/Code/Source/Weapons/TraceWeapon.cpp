@@ -6,6 +6,7 @@
  */
 
 #include <Source/Weapons/TraceWeapon.h>
+#include <Source/Weapons/WeaponProfiler.h>
 
 namespace MultiplayerSample
 {
@@ -29,7 +30,7 @@ namespace MultiplayerSample
 
             const bool isMultiSegmented = (m_weaponParams.m_gatherParams.m_travelSpeed > 0.0f);
 
-            IntersectResults gatherResults;
+            m_gatherResults.clear();
             if (isMultiSegmented)
             {
                 ActiveShot activeShot{ eventData.m_initialTransform, eventData.m_targetPosition, LifetimeSec{ 0.0f } };
@@ -42,28 +43,30 @@ namespace MultiplayerSample
                     AZ_Assert(false, "Attempting to add too many active shots to the TraceWeapon.");
                 }
             }
-            else if (GatherEntities(eventData, gatherResults))
+            else if (GatherEntities(eventData, m_gatherResults))
             {
-                DispatchHitEvents(gatherResults, eventData, m_gatheredNetEntityIds);
+                DispatchHitEvents(m_gatherResults, eventData, m_gatheredNetEntityIds);
             }
         }
     }
 
     void TraceWeapon::TickActiveShots(WeaponState& weaponState, float deltaTime)
     {
+        WeaponProfileScope profileScope(m_weaponParams.m_weaponType, WeaponProfileStage::TickActiveShots);
+
         AZStd::size_t numActiveShots = weaponState.m_activeShots.size();
         for (AZStd::size_t i = 0; i < numActiveShots; ++i)
         {
             ActiveShot& activeShot = weaponState.m_activeShots[i];
 
-            IntersectResults gatherResults;
-            const ShotResult result = GatherEntitiesMultisegment(deltaTime, activeShot, gatherResults);
+            m_gatherResults.clear();
+            const ShotResult result = GatherEntitiesMultisegment(deltaTime, activeShot, m_gatherResults);
 
             // If expired, dispatch hit events, swap and pop
             if (result == ShotResult::ShouldTerminate)
             {
                 ActivateEvent eventData{ activeShot.m_initialTransform, activeShot.m_targetPosition, Multiplayer::InvalidNetEntityId, Multiplayer::InvalidNetEntityId };
-                DispatchHitEvents(gatherResults, eventData, m_gatheredNetEntityIds);
+                DispatchHitEvents(m_gatherResults, eventData, m_gatheredNetEntityIds);
 
                 weaponState.m_activeShots[i] = weaponState.m_activeShots[numActiveShots - 1];
                 weaponState.m_activeShots.pop_back();
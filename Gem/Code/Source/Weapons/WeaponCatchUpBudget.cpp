@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Weapons/WeaponCatchUpBudget.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace MultiplayerSample
+{
+    AZ_CVAR(AZ::TimeMs, cl_WeaponsCatchUpWindowMs, AZ::TimeMs{ 250 }, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Missed activations of simulated weapons fired longer ago than this are skipped instead of replayed");
+    AZ_CVAR(AZ::TimeUs, cl_WeaponsCatchUpBudgetUs, AZ::TimeUs{ 1000 }, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Client frame time replayed weapon activations may spend before the rest of the frame's replays are simulated without effects");
+    AZ_CVAR(bool, cl_WeaponsCatchUpStats, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, periodically logs how much simulated weapon catch-up work was replayed and avoided");
+    AZ_CVAR(AZ::TimeMs, cl_WeaponsCatchUpStatsIntervalMs, AZ::TimeMs{ 5000 }, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How often the simulated weapon catch-up stats are logged");
+
+    void WeaponCatchUpBudget::Activate()
+    {
+        m_frameReplayTimeUs = AZ::Time::ZeroTimeUs;
+        AZ::TickBus::Handler::BusConnect();
+        AZ::Interface<WeaponCatchUpBudget>::Register(this);
+    }
+
+    void WeaponCatchUpBudget::Deactivate()
+    {
+        AZ::Interface<WeaponCatchUpBudget>::Unregister(this);
+        AZ::TickBus::Handler::BusDisconnect();
+    }
+
+    uint32_t WeaponCatchUpBudget::GetReplayCount(uint32_t backlog, AZ::TimeMs cooldownMs) const
+    {
+        AZ::TimeMs inputRateMs = AZ::TimeMs{ 33 };
+        AZ::Interface<AZ::IConsole>::Get()->GetCvarValue("cl_InputRateMs", inputRateMs);
+
+        // Activations can't be closer together than the cooldown, or than one input for weapons without one
+        const AZ::TimeMs activationSpacingMs = AZStd::max(AZStd::max(cooldownMs, inputRateMs), AZ::TimeMs{ 1 });
+        const AZ::TimeMs windowMs = cl_WeaponsCatchUpWindowMs;
+        const uint32_t activationsInWindow = static_cast<uint32_t>(windowMs / activationSpacingMs);
+        return AZStd::clamp<uint32_t>(activationsInWindow, 1, AZStd::max(backlog, 1u));
+    }
+
+    bool WeaponCatchUpBudget::CanPlayEffects() const
+    {
+        const AZ::TimeUs budgetUs = cl_WeaponsCatchUpBudgetUs;
+        return m_frameReplayTimeUs < budgetUs;
+    }
+
+    void WeaponCatchUpBudget::AddReplayTime(AZ::TimeUs replayTimeUs)
+    {
+        m_frameReplayTimeUs += replayTimeUs;
+        m_stats.m_peakFrameTimeUs = AZStd::max(m_stats.m_peakFrameTimeUs, m_frameReplayTimeUs);
+    }
+
+    void WeaponCatchUpBudget::RecordUpdate(uint32_t backlog, uint32_t replayed, uint32_t silenced)
+    {
+        ++m_stats.m_updates;
+        m_stats.m_replayed += replayed;
+        m_stats.m_skipped += backlog - replayed;
+        m_stats.m_silenced += silenced;
+        m_stats.m_peakBacklog = AZStd::max(m_stats.m_peakBacklog, backlog);
+
+        if (!cl_WeaponsCatchUpStats || !m_statsReport.ShouldReport(cl_WeaponsCatchUpStatsIntervalMs))
+        {
+            return;
+        }
+
+        AZLOG_INFO(
+            "Weapon catch-up: %u updates, %u activations replayed, %u skipped, %u replayed without effects, peak backlog %u, "
+            "peak replay time per frame %lld us",
+            m_stats.m_updates, m_stats.m_replayed, m_stats.m_skipped, m_stats.m_silenced, m_stats.m_peakBacklog,
+            static_cast<long long>(m_stats.m_peakFrameTimeUs));
+
+        m_stats = Stats{};
+    }
+
+    void WeaponCatchUpBudget::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        m_frameReplayTimeUs = AZ::Time::ZeroTimeUs;
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Time/ITime.h>
+#include <Source/PeriodicStats.h>
+
+namespace MultiplayerSample
+{
+    //! Bounds the work simulated weapons do when they replay activations they missed, after a network stall or a late join.
+    //! Activations older than cl_WeaponsCatchUpWindowMs are skipped, and once replays have used cl_WeaponsCatchUpBudgetUs of a
+    //! client frame the rest of that frame's replays are simulated without effects.
+    //! The budget is shared by every simulated weapon, since the hitch after a stall comes from all of them catching up at once,
+    //! and it is refilled on every local frame rather than every host frame, since several host frames can arrive in one client frame.
+    class WeaponCatchUpBudget
+        : public AZ::TickBus::Handler
+    {
+    public:
+        AZ_RTTI(WeaponCatchUpBudget, "{6D1B4E0A-92C3-4F5D-8A7E-3C1F0B9D2E64}");
+
+        WeaponCatchUpBudget() = default;
+        virtual ~WeaponCatchUpBudget() = default;
+
+        void Activate();
+        void Deactivate();
+
+        //! Returns how many of the most recent missed activations fall within the catch-up window.
+        //! Activations are assumed to be spaced by the weapon's cooldown, or one input apart for weapons without one.
+        //! @param backlog    the number of activations missed since the last update, at least 1
+        //! @param cooldownMs the weapon's cooldown between activations
+        //! @return the number of activations to replay, between 1 and backlog
+        uint32_t GetReplayCount(uint32_t backlog, AZ::TimeMs cooldownMs) const;
+
+        //! Returns true if a replayed activation starting now may play its effects.
+        bool CanPlayEffects() const;
+
+        //! Charges the time a replayed activation took against this frame's budget.
+        void AddReplayTime(AZ::TimeUs replayTimeUs);
+
+        //! Adds one catch-up update to the stats logged when cl_WeaponsCatchUpStats is enabled.
+        //! @param backlog  the number of activations missed since the last update
+        //! @param replayed the number of those that were replayed
+        //! @param silenced the number of replayed activations that were simulated without effects
+        void RecordUpdate(uint32_t backlog, uint32_t replayed, uint32_t silenced);
+
+    private:
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        struct Stats
+        {
+            uint32_t m_updates = 0;
+            uint32_t m_replayed = 0;
+            uint32_t m_skipped = 0;
+            uint32_t m_silenced = 0;
+            uint32_t m_peakBacklog = 0;
+            AZ::TimeUs m_peakFrameTimeUs = AZ::Time::ZeroTimeUs;
+        };
+
+        AZ::TimeUs m_frameReplayTimeUs = AZ::Time::ZeroTimeUs;
+        Stats m_stats;
+        PeriodicStats m_statsReport;
+    };
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Weapons/WeaponHitAggregator.h>
+#include <Source/Components/NetworkHealthComponent.h>
+#include <AzCore/Console/IConsole.h>
+#include <Multiplayer/Components/NetworkRigidBodyComponent.h>
+#include <Multiplayer/IMultiplayer.h>
+
+namespace MultiplayerSample
+{
+#if AZ_TRAIT_SERVER
+    AZ_CVAR(bool, sv_WeaponsAggregateHits, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, all weapon hits on an entity within a tick are folded into one health delta and one impulse");
+
+    void WeaponHitAggregator::Activate()
+    {
+        AZ::Interface<WeaponHitAggregator>::Register(this);
+    }
+
+    void WeaponHitAggregator::Deactivate()
+    {
+        m_applyPendingHitsEvent.RemoveFromQueue();
+        m_pendingHits.clear();
+        AZ::Interface<WeaponHitAggregator>::Unregister(this);
+    }
+
+    void WeaponHitAggregator::AddHit(Multiplayer::NetEntityId hitEntity, float damage, const AZ::Vector3& impulse, const AZ::Vector3& position)
+    {
+        if (!sv_WeaponsAggregateHits)
+        {
+            PendingHit pendingHit{ Multiplayer::GetNetworkEntityManager()->GetEntity(hitEntity) };
+            if (FindHitComponents(pendingHit))
+            {
+                pendingHit.m_damage = damage;
+                pendingHit.m_impulse = impulse;
+                ApplyHit(pendingHit, position);
+            }
+            return;
+        }
+
+        auto [pendingHitIter, inserted] = m_pendingHits.try_emplace(hitEntity);
+        PendingHit& pendingHit = pendingHitIter->second;
+        if (inserted)
+        {
+            // First hit on this entity this tick, look its components up once
+            pendingHit.m_entityHandle = Multiplayer::GetNetworkEntityManager()->GetEntity(hitEntity);
+            if (!FindHitComponents(pendingHit))
+            {
+                m_pendingHits.erase(pendingHitIter);
+                return;
+            }
+        }
+
+        pendingHit.m_damage += damage;
+        pendingHit.m_impulse += impulse;
+        pendingHit.m_impulsePosition += position * damage;
+
+        // Applied on the next server frame, see the class comment for why that one frame delay is acceptable
+        if (!m_applyPendingHitsEvent.IsScheduled())
+        {
+            m_applyPendingHitsEvent.Enqueue(AZ::Time::ZeroTimeMs, false);
+        }
+    }
+
+    bool WeaponHitAggregator::FindHitComponents(PendingHit& pendingHit)
+    {
+        const AZ::Entity* entity = pendingHit.m_entityHandle.Exists() ? pendingHit.m_entityHandle.GetEntity() : nullptr;
+        if (entity == nullptr)
+        {
+            return false;
+        }
+
+        pendingHit.m_rigidBody = entity->FindComponent<Multiplayer::NetworkRigidBodyComponent>();
+        pendingHit.m_health = entity->FindComponent<NetworkHealthComponent>();
+        return (pendingHit.m_rigidBody != nullptr) || (pendingHit.m_health != nullptr);
+    }
+
+    void WeaponHitAggregator::ApplyHit(const PendingHit& pendingHit, const AZ::Vector3& impulsePosition)
+    {
+        // Look for physics rigid body component and make impact updates
+        if (pendingHit.m_rigidBody)
+        {
+            pendingHit.m_rigidBody->SendApplyImpulse(pendingHit.m_impulse, impulsePosition);
+        }
+
+        // Look for health component and directly update health based on hit parameters
+        if (pendingHit.m_health)
+        {
+            pendingHit.m_health->SendHealthDelta(pendingHit.m_damage * -1.0f);
+        }
+    }
+
+    void WeaponHitAggregator::ApplyPendingHits()
+    {
+        for (const auto& [hitEntity, pendingHit] : m_pendingHits)
+        {
+            // The entity may have been removed since its first hit this tick, in which case the cached components are gone too
+            if (!pendingHit.m_entityHandle.Exists())
+            {
+                continue;
+            }
+
+            // The summed impulse is applied at the damage weighted average of the hit positions
+            const AZ::Vector3 impulsePosition = (pendingHit.m_damage > 0.0f)
+                ? pendingHit.m_impulsePosition / pendingHit.m_damage
+                : pendingHit.m_entityHandle.GetEntity()->GetTransform()->GetWorldTranslation();
+            ApplyHit(pendingHit, impulsePosition);
+        }
+        m_pendingHits.clear();
+    }
+#endif
+}
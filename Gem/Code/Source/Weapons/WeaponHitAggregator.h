@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+
+namespace Multiplayer { class NetworkRigidBodyComponent; }
+
+namespace MultiplayerSample
+{
+    class NetworkHealthComponent;
+
+#if AZ_TRAIT_SERVER
+    //! Folds every confirmed weapon hit on an entity within a tick into a single health delta and a single impulse.
+    //! Multi-hit gathers (and several shooters hitting the same target) then cost one component lookup and one pair of RPCs
+    //! per hit entity per tick, rather than per hit. Toggle with sv_WeaponsAggregateHits to compare against applying each hit directly.
+    //! The folded hits are applied by a zero delay ScheduledEvent, which runs on the next server frame, so aggregated health and impulses
+    //! land one server frame after the hit. Hits are gathered while inputs are processed and from scheduled weapon ticks, and the
+    //! scheduler is the one point that runs after both for every shooter. The delay is accepted because:
+    //! - the confirmed hit RPC, and so every client side hit effect, is still sent in the frame of the hit;
+    //! - one server frame is small next to the network latency clients already see before the server's health reaches them;
+    //! - sv_WeaponsAggregateHits off applies each hit immediately, for when the delay matters more than the saved lookups and RPCs.
+    class WeaponHitAggregator
+    {
+    public:
+        AZ_RTTI(WeaponHitAggregator, "{BA813EA3-2788-45C5-9DF1-C63B06B72DC1}");
+
+        WeaponHitAggregator() = default;
+        virtual ~WeaponHitAggregator() = default;
+
+        void Activate();
+        void Deactivate();
+
+        //! Queues damage and an impulse for an entity. They are applied on the next server frame, once the current frame's hits have all been gathered.
+        //! @param hitEntity the entity that was hit
+        //! @param damage    the health to remove
+        //! @param impulse   the impulse to apply to the entity's rigid body, if it has one
+        //! @param position  the world position of the hit
+        void AddHit(Multiplayer::NetEntityId hitEntity, float damage, const AZ::Vector3& impulse, const AZ::Vector3& position);
+
+    private:
+        struct PendingHit
+        {
+            Multiplayer::ConstNetworkEntityHandle m_entityHandle;
+            Multiplayer::NetworkRigidBodyComponent* m_rigidBody = nullptr;
+            NetworkHealthComponent* m_health = nullptr;
+            float m_damage = 0.0f;
+            AZ::Vector3 m_impulse = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_impulsePosition = AZ::Vector3::CreateZero(); //!< Hit positions weighted by damage, normalized on apply
+        };
+
+        static bool FindHitComponents(PendingHit& pendingHit);
+        static void ApplyHit(const PendingHit& pendingHit, const AZ::Vector3& impulsePosition);
+
+        void ApplyPendingHits();
+
+        // Component pointers are cached here per hit entity and only live until the end of the tick
+        AZStd::unordered_map<Multiplayer::NetEntityId, PendingHit> m_pendingHits;
+
+        AZ::ScheduledEvent m_applyPendingHitsEvent{ [this]()
+        {
+            ApplyPendingHits();
+        }, AZ::Name("WeaponHitAggregatorApply") };
+    };
+#endif
+}
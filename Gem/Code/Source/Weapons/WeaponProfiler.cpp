@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Weapons/WeaponProfiler.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/FileIO.h>
+
+namespace MultiplayerSample
+{
+    const char* GetEnumString(WeaponProfileStage value)
+    {
+        switch (value)
+        {
+        case WeaponProfileStage::Activate:
+            return "Activate";
+        case WeaponProfileStage::TickActiveShots:
+            return "TickActiveShots";
+        case WeaponProfileStage::GatherEntities:
+            return "GatherEntities";
+        case WeaponProfileStage::WorldIntersect:
+            return "WorldIntersect";
+        case WeaponProfileStage::ConfirmHit:
+            return "ConfirmHit";
+        case WeaponProfileStage::Count:
+            break;
+        }
+        return "UNKNOWN";
+    }
+
+#if AZ_TRAIT_SERVER
+    AZ_CVAR(bool, sv_WeaponsProfile, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, server weapon work is timed per weapon type and stage");
+    AZ_CVAR(AZ::TimeMs, sv_WeaponsProfileCsvIntervalMs, AZ::Time::ZeroTimeMs, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How often the weapons profile totals are appended to sv_WeaponsProfileCsvFile, 0 disables the CSV");
+    AZ_CVAR(AZ::CVarFixedString, sv_WeaponsProfileCsvFile, "@user@/weapons_profile.csv", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The CSV file the weapons profile totals are appended to");
+
+    static int64_t ToMicroseconds(AZStd::chrono::steady_clock::duration duration)
+    {
+        return static_cast<int64_t>(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(duration).count());
+    }
+
+    void WeaponProfiler::Activate()
+    {
+        AZ::Interface<WeaponProfiler>::Register(this);
+        m_commitFrameEvent.Enqueue(AZ::Time::ZeroTimeMs, true);
+    }
+
+    void WeaponProfiler::Deactivate()
+    {
+        m_commitFrameEvent.RemoveFromQueue();
+        if (m_csvStream.IsOpen())
+        {
+            m_csvStream.Close();
+        }
+        m_csvOpenFailed = false;
+        AZ::Interface<WeaponProfiler>::Unregister(this);
+    }
+
+    void WeaponProfiler::RecordStage(WeaponType weaponType, WeaponProfileStage stage, AZStd::chrono::steady_clock::duration duration)
+    {
+        StageSample& sample = m_currentFrame.m_stages[aznumeric_cast<uint32_t>(weaponType)][aznumeric_cast<uint32_t>(stage)];
+        ++sample.m_calls;
+        sample.m_time += duration;
+    }
+
+    WeaponType WeaponProfiler::GetCurrentWeaponType() const
+    {
+        return m_currentWeaponType;
+    }
+
+    void WeaponProfiler::SetCurrentWeaponType(WeaponType weaponType)
+    {
+        m_currentWeaponType = weaponType;
+    }
+
+    void WeaponProfiler::CommitFrame()
+    {
+        const AZ::TimeMs currentTime = AZ::GetElapsedTimeMs();
+        m_currentFrame.m_hostTimeMs = currentTime;
+
+        // Publish the frame only once its slot is fully written
+        const uint64_t frameIndex = m_framesWritten.load(AZStd::memory_order_relaxed);
+        m_history[frameIndex % HistoryFrameCount] = m_currentFrame;
+        m_framesWritten.store(frameIndex + 1, AZStd::memory_order_release);
+
+        if (sv_WeaponsProfileCsvIntervalMs > AZ::Time::ZeroTimeMs)
+        {
+            if (m_intervalTotals.m_frames == 0)
+            {
+                m_intervalTotals.m_startTimeMs = currentTime;
+            }
+
+            ++m_intervalTotals.m_frames;
+            for (uint32_t typeIndex = 0; typeIndex < WeaponTypeCount; ++typeIndex)
+            {
+                for (uint32_t stageIndex = 0; stageIndex < StageCount; ++stageIndex)
+                {
+                    const StageSample& frameSample = m_currentFrame.m_stages[typeIndex][stageIndex];
+                    StageSample& totalSample = m_intervalTotals.m_stages[typeIndex][stageIndex];
+                    totalSample.m_calls += frameSample.m_calls;
+                    totalSample.m_time += frameSample.m_time;
+
+                    auto& peakFrameTime = m_intervalTotals.m_peakFrameTime[typeIndex][stageIndex];
+                    peakFrameTime = AZStd::max(peakFrameTime, frameSample.m_time);
+                }
+            }
+
+            if (currentTime - m_intervalTotals.m_startTimeMs >= sv_WeaponsProfileCsvIntervalMs)
+            {
+                WriteCsv(currentTime);
+                m_intervalTotals = IntervalTotals{};
+            }
+        }
+
+        m_currentFrame = FrameSample{};
+    }
+
+    bool WeaponProfiler::OpenCsv()
+    {
+        AZ::IO::FixedMaxPath csvPath;
+        const AZ::CVarFixedString csvFile = sv_WeaponsProfileCsvFile;
+        if (!AZ::IO::FileIOBase::GetInstance() || !AZ::IO::FileIOBase::GetInstance()->ResolvePath(csvPath, csvFile.c_str()))
+        {
+            csvPath = csvFile.c_str();
+        }
+
+        constexpr AZ::IO::OpenMode openMode = AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath;
+        if (!m_csvStream.Open(csvPath.c_str(), openMode))
+        {
+            AZLOG_WARN("Weapons profiler failed to open %s, profile totals will not be written", csvPath.c_str());
+            return false;
+        }
+
+        constexpr AZStd::string_view header = "hostTimeMs,frames,weaponType,stage,calls,totalUs,avgFrameUs,peakFrameUs\n";
+        m_csvStream.Write(header.size(), header.data());
+        return true;
+    }
+
+    void WeaponProfiler::WriteCsv(AZ::TimeMs currentTime)
+    {
+        if (!m_csvStream.IsOpen())
+        {
+            // Only try the file once per activation rather than warning every interval
+            if (m_csvOpenFailed || !OpenCsv())
+            {
+                m_csvOpenFailed = true;
+                return;
+            }
+        }
+
+        for (uint32_t typeIndex = 0; typeIndex < WeaponTypeCount; ++typeIndex)
+        {
+            for (uint32_t stageIndex = 0; stageIndex < StageCount; ++stageIndex)
+            {
+                const StageSample& totalSample = m_intervalTotals.m_stages[typeIndex][stageIndex];
+                if (totalSample.m_calls == 0)
+                {
+                    continue;
+                }
+
+                const int64_t totalUs = ToMicroseconds(totalSample.m_time);
+                const AZStd::string row = AZStd::string::format("%lld,%u,%s,%s,%u,%lld,%.3f,%lld\n",
+                    static_cast<long long>(currentTime), m_intervalTotals.m_frames,
+                    GetEnumString(static_cast<WeaponType>(typeIndex)), GetEnumString(static_cast<WeaponProfileStage>(stageIndex)),
+                    totalSample.m_calls, static_cast<long long>(totalUs),
+                    static_cast<double>(totalUs) / AZStd::max(m_intervalTotals.m_frames, 1u),
+                    static_cast<long long>(ToMicroseconds(m_intervalTotals.m_peakFrameTime[typeIndex][stageIndex])));
+                m_csvStream.Write(row.size(), row.data());
+            }
+        }
+    }
+
+    void WeaponProfiler::DumpWeaponsProfile(const AZ::ConsoleCommandContainer& arguments)
+    {
+        const uint64_t framesWritten = m_framesWritten.load(AZStd::memory_order_acquire);
+        uint64_t frameCount = AZStd::min<uint64_t>(framesWritten, HistoryFrameCount);
+        uint32_t requestedFrameCount = 0;
+        if (!arguments.empty() && AZ::ConsoleTypeHelpers::StringToValue(requestedFrameCount, arguments.front()))
+        {
+            frameCount = AZStd::min<uint64_t>(frameCount, requestedFrameCount);
+        }
+
+        if (frameCount == 0)
+        {
+            AZLOG_INFO("Weapons profile: no frames recorded");
+            return;
+        }
+
+        StageSamples totals;
+        AZStd::array<AZStd::array<AZStd::chrono::steady_clock::duration, StageCount>, WeaponTypeCount> peakFrameTime = {};
+        for (uint64_t frameIndex = framesWritten - frameCount; frameIndex < framesWritten; ++frameIndex)
+        {
+            const FrameSample& frame = m_history[frameIndex % HistoryFrameCount];
+            for (uint32_t typeIndex = 0; typeIndex < WeaponTypeCount; ++typeIndex)
+            {
+                for (uint32_t stageIndex = 0; stageIndex < StageCount; ++stageIndex)
+                {
+                    const StageSample& frameSample = frame.m_stages[typeIndex][stageIndex];
+                    totals[typeIndex][stageIndex].m_calls += frameSample.m_calls;
+                    totals[typeIndex][stageIndex].m_time += frameSample.m_time;
+                    peakFrameTime[typeIndex][stageIndex] = AZStd::max(peakFrameTime[typeIndex][stageIndex], frameSample.m_time);
+                }
+            }
+        }
+
+        AZLOG_INFO("Weapons profile over the last %llu frames:", static_cast<unsigned long long>(frameCount));
+        for (uint32_t typeIndex = 0; typeIndex < WeaponTypeCount; ++typeIndex)
+        {
+            for (uint32_t stageIndex = 0; stageIndex < StageCount; ++stageIndex)
+            {
+                const StageSample& totalSample = totals[typeIndex][stageIndex];
+                if (totalSample.m_calls == 0)
+                {
+                    continue;
+                }
+
+                const int64_t totalUs = ToMicroseconds(totalSample.m_time);
+                AZLOG_INFO("  %-10s %-16s %8u calls %10lld us total %10.3f us/frame %8lld us peak frame",
+                    GetEnumString(static_cast<WeaponType>(typeIndex)), GetEnumString(static_cast<WeaponProfileStage>(stageIndex)),
+                    totalSample.m_calls, static_cast<long long>(totalUs), static_cast<double>(totalUs) / frameCount,
+                    static_cast<long long>(ToMicroseconds(peakFrameTime[typeIndex][stageIndex])));
+            }
+        }
+    }
+
+    WeaponProfileScope::WeaponProfileScope(WeaponType weaponType, WeaponProfileStage stage)
+        : m_profiler(sv_WeaponsProfile ? AZ::Interface<WeaponProfiler>::Get() : nullptr)
+        , m_weaponType(weaponType)
+        , m_stage(stage)
+    {
+        if (m_profiler)
+        {
+            m_previousWeaponType = m_profiler->GetCurrentWeaponType();
+            m_profiler->SetCurrentWeaponType(weaponType);
+            m_startTime = AZStd::chrono::steady_clock::now();
+        }
+    }
+
+    WeaponProfileScope::WeaponProfileScope(WeaponProfileStage stage)
+        : m_profiler(sv_WeaponsProfile ? AZ::Interface<WeaponProfiler>::Get() : nullptr)
+        , m_stage(stage)
+    {
+        if (m_profiler)
+        {
+            m_weaponType = m_profiler->GetCurrentWeaponType();
+            m_previousWeaponType = m_weaponType;
+            m_startTime = AZStd::chrono::steady_clock::now();
+        }
+    }
+
+    WeaponProfileScope::~WeaponProfileScope()
+    {
+        if (m_profiler)
+        {
+            m_profiler->RecordStage(m_weaponType, m_stage, AZStd::chrono::steady_clock::now() - m_startTime);
+            m_profiler->SetCurrentWeaponType(m_previousWeaponType);
+        }
+    }
+#endif
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <Source/Weapons/WeaponTypes.h>
+
+namespace MultiplayerSample
+{
+    //! Weapon work that the server weapons profiler breaks tick time down by.
+    //! Stage times are inclusive, so an Activate that gathers and confirms hits also contains that gather and confirm time.
+    enum class WeaponProfileStage
+    {
+        Activate,
+        TickActiveShots,
+        GatherEntities,
+        WorldIntersect,
+        ConfirmHit,
+        Count
+    };
+    const char* GetEnumString(WeaponProfileStage value);
+
+#if AZ_TRAIT_SERVER
+    //! Accumulates per WeaponType, per WeaponProfileStage call counts and times for every server tick.
+    //! Each tick is committed to a fixed ring of recent frames, which the DumpWeaponsProfile console command summarizes, and folded into
+    //! running totals that are appended to a CSV every sv_WeaponsProfileCsvIntervalMs.
+    //! Recording a stage costs two clock reads and a few adds, so sv_WeaponsProfile is meant to be left on.
+    class WeaponProfiler
+    {
+    public:
+        AZ_RTTI(WeaponProfiler, "{2E0B2D4A-5B61-4C8E-9D3F-7A41C6E0F915}");
+
+        static constexpr uint32_t WeaponTypeCount = aznumeric_cast<uint32_t>(WeaponType::Projectile) + 1;
+        static constexpr uint32_t StageCount = aznumeric_cast<uint32_t>(WeaponProfileStage::Count);
+        static constexpr uint32_t HistoryFrameCount = 256;
+
+        WeaponProfiler() = default;
+        virtual ~WeaponProfiler() = default;
+
+        void Activate();
+        void Deactivate();
+
+        //! Adds one call of the given stage to the current frame.
+        //! @param weaponType the type of weapon that did the work
+        //! @param stage      the stage of weapon work that was done
+        //! @param duration   how long the work took
+        void RecordStage(WeaponType weaponType, WeaponProfileStage stage, AZStd::chrono::steady_clock::duration duration);
+
+        //! The weapon type of the innermost typed WeaponProfileScope, for work that doesn't know which weapon it is for.
+        WeaponType GetCurrentWeaponType() const;
+        void SetCurrentWeaponType(WeaponType weaponType);
+
+    private:
+        struct StageSample
+        {
+            uint32_t m_calls = 0;
+            AZStd::chrono::steady_clock::duration m_time = AZStd::chrono::steady_clock::duration::zero();
+        };
+        using StageSamples = AZStd::array<AZStd::array<StageSample, StageCount>, WeaponTypeCount>;
+
+        struct FrameSample
+        {
+            AZ::TimeMs m_hostTimeMs = AZ::Time::ZeroTimeMs;
+            StageSamples m_stages;
+        };
+
+        struct IntervalTotals
+        {
+            AZ::TimeMs m_startTimeMs = AZ::Time::ZeroTimeMs;
+            uint32_t m_frames = 0;
+            StageSamples m_stages;
+            AZStd::array<AZStd::array<AZStd::chrono::steady_clock::duration, StageCount>, WeaponTypeCount> m_peakFrameTime = {};
+        };
+
+        void CommitFrame();
+        void WriteCsv(AZ::TimeMs currentTime);
+        bool OpenCsv();
+
+        //! Summarizes the most recent frames of the ring, all of them when no frame count is given.
+        void DumpWeaponsProfile(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(WeaponProfiler, DumpWeaponsProfile, AZ::ConsoleFunctorFlags::Null, "Prints per weapon type call counts and times for recent server frames");
+
+        FrameSample m_currentFrame;
+        IntervalTotals m_intervalTotals;
+        WeaponType m_currentWeaponType = WeaponType::None;
+
+        // Single producer ring, the tick commits a frame and then publishes it by advancing m_framesWritten
+        AZStd::array<FrameSample, HistoryFrameCount> m_history;
+        AZStd::atomic<uint64_t> m_framesWritten{ 0 };
+
+        AZ::IO::SystemFileStream m_csvStream;
+        bool m_csvOpenFailed = false;
+
+        AZ::ScheduledEvent m_commitFrameEvent{ [this]()
+        {
+            CommitFrame();
+        }, AZ::Name("WeaponProfilerCommitFrame") };
+    };
+
+    //! Times the enclosing block and records it against a weapon type and stage when sv_WeaponsProfile is enabled.
+    class WeaponProfileScope
+    {
+    public:
+        WeaponProfileScope(WeaponType weaponType, WeaponProfileStage stage);
+
+        //! Attributes the work to the weapon type of the enclosing typed scope.
+        explicit WeaponProfileScope(WeaponProfileStage stage);
+
+        ~WeaponProfileScope();
+
+        WeaponProfileScope(const WeaponProfileScope&) = delete;
+        WeaponProfileScope& operator=(const WeaponProfileScope&) = delete;
+
+    private:
+        WeaponProfiler* m_profiler = nullptr;
+        WeaponType m_weaponType = WeaponType::None;
+        WeaponType m_previousWeaponType = WeaponType::None;
+        WeaponProfileStage m_stage = WeaponProfileStage::Count;
+        AZStd::chrono::steady_clock::time_point m_startTime;
+    };
+#else
+    class WeaponProfileScope
+    {
+    public:
+        WeaponProfileScope([[maybe_unused]] WeaponType weaponType, [[maybe_unused]] WeaponProfileStage stage) {}
+        explicit WeaponProfileScope([[maybe_unused]] WeaponProfileStage stage) {}
+    };
+#endif
+}
@@ -6,6 +6,7 @@
  */
 
 #include <Source/Weapons/WeaponTypes.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -238,6 +239,28 @@ namespace MultiplayerSample
         }
     }
 
+    HitEffectFalloffTable::HitEffectFalloffTable(const HitEffect& effect, float maxDistance)
+    {
+        const float sampleSpacing = (maxDistance > 0.0f) ? maxDistance / static_cast<float>(SampleCount - 1) : 0.0f;
+        m_distanceToSample = (sampleSpacing > 0.0f) ? 1.0f / sampleSpacing : 0.0f;
+
+        for (uint32_t i = 0; i < SampleCount; ++i)
+        {
+            // HitMagnitude * ((HitFalloff * (1 - Distance / MaxDistance)) ^ HitExponent)
+            const float distanceRatio = (maxDistance > 0.0f) ? (static_cast<float>(i) * sampleSpacing) / maxDistance : 0.0f;
+            const float base = AZStd::max(effect.m_hitFalloff * (1.0f - distanceRatio), 0.0f);
+            m_samples[i] = effect.m_hitMagnitude * powf(base, effect.m_hitExponent);
+        }
+    }
+
+    float HitEffectFalloffTable::GetMagnitude(float distance) const
+    {
+        const float samplePosition = AZStd::clamp(distance * m_distanceToSample, 0.0f, static_cast<float>(SampleCount - 1));
+        const uint32_t sampleIndex = AZStd::min(static_cast<uint32_t>(samplePosition), SampleCount - 2);
+        const float t = samplePosition - static_cast<float>(sampleIndex);
+        return AZ::Lerp(m_samples[sampleIndex], m_samples[sampleIndex + 1], t);
+    }
+
     bool HitEffect::Serialize(AzNetworking::ISerializer& serializer)
     {
         return serializer.Serialize(m_hitMagnitude, "HitMagnitude")
@@ -11,6 +11,7 @@
 #include <Source/Effects/GameEffect.h>
 #include <Multiplayer/MultiplayerTypes.h>
 #include <AzCore/RTTI/TypeSafeIntegral.h>
+#include <AzCore/std/containers/array.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
 
 namespace MultiplayerSample
@@ -110,6 +111,26 @@ namespace MultiplayerSample
         static void Reflect(AZ::ReflectContext* context);
     };
 
+    //! A HitEffect's falloff curve sampled at fixed distance steps over [0, MaxDistance].
+    //! Evaluating a hit is a table lookup and a lerp rather than a powf, which keeps distance falloff cheap enough to run for every hit.
+    class HitEffectFalloffTable
+    {
+    public:
+        static constexpr uint32_t SampleCount = 32;
+
+        HitEffectFalloffTable() = default;
+        HitEffectFalloffTable(const HitEffect& effect, float maxDistance);
+
+        //! Returns the effect magnitude at the given distance, distances beyond MaxDistance are clamped to it.
+        //! @param distance the distance from the shot origin to the hit
+        //! @return the magnitude to apply
+        float GetMagnitude(float distance) const;
+
+    private:
+        AZStd::array<float, SampleCount> m_samples = {};
+        float m_distanceToSample = 0.0f;
+    };
+
     //! Parameters that control the behaviour of a weapon.
     struct WeaponParams
     {
@@ -175,11 +196,12 @@ namespace MultiplayerSample
         AZ::Vector3 m_hitPosition = AZ::Vector3::CreateZero(); // Location where the entity was hit, NOT the location of the projectile or weapon in the case of area damage
         AZ::Vector3 m_hitNormal = AZ::Vector3::CreateZero();
         Multiplayer::NetEntityId m_hitNetEntityId = Multiplayer::InvalidNetEntityId; // Entity Id of the entity which was hit
+        float m_hitDistance = 0.0f; // Distance from the shot origin to the hit, only valid on the host that gathered the hit and not replicated
 
         bool Serialize(AzNetworking::ISerializer& serializer);
         static void Reflect(AZ::ReflectContext* context);
     };
-    using HitEntities = AZStd::vector<HitEntity>;
+    using HitEntities = AZStd::fixed_vector<HitEntity, MaxHitEntities>;
 
     //! Structure containing details for a single weapon hit event.
     struct HitEvent
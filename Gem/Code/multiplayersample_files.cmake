@@ -21,8 +21,12 @@ set(FILES
     Source/Components/AttachPlayerWeaponComponent.cpp
     Source/Components/ExampleFilteredEntityComponent.h
     Source/Components/ExampleFilteredEntityComponent.cpp
+    Source/Components/QuantizedTransformBoundsComponent.h
+    Source/Components/QuantizedTransformBoundsComponent.cpp
     Source/Components/NetworkAiComponent.cpp
     Source/Components/NetworkAiComponent.h
+    Source/Components/NetworkAiSystem.cpp
+    Source/Components/NetworkAiSystem.h
     Source/Components/NetworkAnimationComponent.cpp
     Source/Components/NetworkAnimationComponent.h
     Source/Components/NetworkHealthComponent.cpp
@@ -47,10 +51,16 @@ set(FILES
     Source/Components/PerfTest/NetworkTestSpawnerComponent.h
     Source/Components/PerfTest/NetworkRandomTranslateComponent.cpp
     Source/Components/PerfTest/NetworkRandomTranslateComponent.h
+    Source/Components/PerfTest/NetworkRandomTranslateSystem.cpp
+    Source/Components/PerfTest/NetworkRandomTranslateSystem.h
+    Source/Components/PerfTest/PerfTestSpatialHash.cpp
+    Source/Components/PerfTest/PerfTestSpatialHash.h
     Source/Components/NetworkStressTestComponent.cpp
     Source/Components/NetworkStressTestComponent.h
     Source/Components/NetworkPlayerMovementComponent.cpp
     Source/Components/NetworkPlayerMovementComponent.h
+    Source/Components/NetworkQuantizedTransformComponent.cpp
+    Source/Components/NetworkQuantizedTransformComponent.h
 
     Source/Components/UI/UiCoinCountComponent.cpp
     Source/Components/UI/UiCoinCountComponent.h
@@ -79,6 +89,8 @@ set(FILES
     Source/Components/RpcTesterComponent.cpp
     Source/Components/RpcTesterComponent.h
     
+    Source/Components/DecalRing.cpp
+    Source/Components/DecalRing.h
     Source/Components/ScriptableDecalComponent.cpp
     Source/Components/ScriptableDecalComponent.h
 
@@ -91,13 +103,26 @@ set(FILES
     Source/Weapons/TraceWeapon.h
     Source/Weapons/WeaponGathers.cpp
     Source/Weapons/WeaponGathers.h
+    Source/Weapons/WeaponCatchUpBudget.cpp
+    Source/Weapons/WeaponCatchUpBudget.h
+    Source/Weapons/WeaponHitAggregator.cpp
+    Source/Weapons/WeaponHitAggregator.h
+    Source/Weapons/WeaponProfiler.cpp
+    Source/Weapons/WeaponProfiler.h
     Source/Weapons/WeaponTypes.cpp
     Source/Weapons/WeaponTypes.h
     Source/Weapons/SceneQuery.cpp
     Source/Weapons/SceneQuery.h
     Source/Effects/GameEffect.cpp
     Source/Effects/GameEffect.h
+    Source/GameplayTrace.cpp
+    Source/GameplayTrace.h
+    Source/Replay/ServerInputRecorder.cpp
+    Source/Replay/ServerInputRecorder.h
+    Source/Replay/ServerInputReplayer.cpp
+    Source/Replay/ServerInputReplayer.h
     Source/MultiplayerSampleSystemComponent.cpp
     Source/MultiplayerSampleSystemComponent.h
     Source/MultiplayerSampleTypes.h
+    Source/PeriodicStats.h
 )
@@ -0,0 +1,14 @@
+#
+# Copyright (c) Contributors to the Open 3D Engine Project.
+# For complete copyright and license terms please see the LICENSE at the root of this distribution.
+#
+# SPDX-License-Identifier: Apache-2.0 OR MIT
+#
+
+# Replays a server input recording on a headless server and exits once the replay finishes.
+# Usage: ./launch_replay_server.sh [recording file]
+# Set PROFILER to run the replay under a profiler, for example: PROFILER="perf record -g" ./launch_replay_server.sh
+
+RECORDING_FILE=${1:-@user@/server_inputs.mpsrec}
+
+$PROFILER ./build/linux/bin/profile/MultiplayerSample.ServerLauncher --console-command-file=launch_replay_server.cfg --rhi=null -NullRenderer -bg_ConnectToAssetProcessor=0 -sv_terminateOnPlayerExit=false -sv_serverRecordingFile=$RECORDING_FILE
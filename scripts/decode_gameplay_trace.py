@@ -0,0 +1,93 @@
+#
+# Copyright (c) Contributors to the Open 3D Engine Project.
+# For complete copyright and license terms please see the LICENSE at the root of this distribution.
+#
+# SPDX-License-Identifier: Apache-2.0 OR MIT
+#
+#
+
+"""
+Decodes a gameplay trace written by the DumpGameplayTrace console command into CSV.
+
+The dump carries its own event names and payload layouts, so it can be decoded without the build that wrote it:
+    python decode_gameplay_trace.py gameplay_trace.bin > gameplay_trace.csv
+"""
+
+import argparse
+import csv
+import struct
+import sys
+
+TRACE_MAGIC = b'MPSTRACE'
+TRACE_VERSION = 2
+RECORD_FORMAT = struct.Struct('<QQIHH6I')  # timeUs, netEntityId, hostFrameId, event, payloadWordCount, payload[6]
+
+
+def read_cstring(data: bytes, offset: int) -> (str, int):
+    end = data.index(b'\0', offset)
+    return data[offset:end].decode('utf-8'), end + 1
+
+
+def decode_field(words, index: int, field_type: str) -> (object, int):
+    """Decodes the field starting at words[index], returns its value and the index of the next field."""
+    if field_type == 'u64':
+        # Written low word first
+        high = words[index + 1] if index + 1 < len(words) else 0
+        return words[index] | (high << 32), index + 2
+    if field_type == 'f32':
+        return struct.unpack('<f', struct.pack('<I', words[index]))[0], index + 1
+    # u32 and enum values are written as-is, enums are reported by their underlying value
+    return words[index], index + 1
+
+
+def decode_trace(data: bytes, writer) -> int:
+    if data[:len(TRACE_MAGIC)] != TRACE_MAGIC:
+        raise ValueError('Not a gameplay trace file')
+
+    version, trace_level, record_size, event_count, record_count = struct.unpack_from('<5I', data, len(TRACE_MAGIC))
+    if version != TRACE_VERSION:
+        raise ValueError(f'Unsupported gameplay trace version {version}')
+    if record_size != RECORD_FORMAT.size:
+        raise ValueError(f'Unexpected record size {record_size}, expected {RECORD_FORMAT.size}')
+
+    offset = len(TRACE_MAGIC) + 5 * 4
+    events = []
+    for _ in range(event_count):
+        name, offset = read_cstring(data, offset)
+        payload, offset = read_cstring(data, offset)
+        fields = [field.split(':') for field in payload.split(',')] if payload else []
+        events.append((name, fields))
+
+    writer.writerow(['timeUs', 'hostFrameId', 'netEntityId', 'event', 'payload'])
+    for _ in range(record_count):
+        time_us, net_entity_id, host_frame_id, event, word_count, *words = RECORD_FORMAT.unpack_from(data, offset)
+        offset += record_size
+
+        name, fields = events[event] if event < len(events) else (f'Unknown{event}', [])
+        words = words[:word_count]
+        values = []
+        word_index = 0
+        field_index = 0
+        while word_index < word_count:
+            field_name, field_type = fields[field_index] if field_index < len(fields) else (f'word{word_index}', 'u32')
+            value, word_index = decode_field(words, word_index, field_type)
+            values.append(f'{field_name}={value}')
+            field_index += 1
+        writer.writerow([time_us, host_frame_id, net_entity_id, name, ' '.join(values)])
+
+    return trace_level
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decodes a MultiplayerSample gameplay trace dump into CSV')
+    parser.add_argument('trace_file', help='the file written by DumpGameplayTrace')
+    args = parser.parse_args()
+
+    with open(args.trace_file, 'rb') as trace_file:
+        data = trace_file.read()
+
+    decode_trace(data, csv.writer(sys.stdout))
+
+
+if __name__ == '__main__':
+    main()